@@ -5,6 +5,16 @@ newoption {
 	description = "Set query minimal Vulkan SDK version"
 }
 
+newoption {
+	trigger = "with-zstd",
+	description = "Compress pipeline cache files with zstd"
+}
+
+newoption {
+	trigger = "with-xxhash",
+	description = "Expose XXH3 hashing in MicroVulkanChecksum"
+}
+
 --- ENVIRONEMENT VARIABLES
 vulkan = os.getenv( "VULKAN_PATH" )
 
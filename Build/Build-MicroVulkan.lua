@@ -20,6 +20,11 @@ project "MicroVulkan"
 		"%{IncludeDirs.Vulkan}Include/"
 	}
 
+	--- GLOBAL DEFINES
+	defines { 
+		"MICRO_VULKAN_SDK_VERSION=\"".._OPTIONS[ "vk_version" ].."\""
+	}
+
 	--- PRECOMPILED HEADER
 	pchheader "__micro_vulkan_pch.h"
 
@@ -51,6 +56,16 @@ project "MicroVulkan"
 		--- PRECOMPILED SOURCE
 		pchsource "../MicroVulkan/__micro_vulkan_pch.cpp"
 
+	-- ZSTD
+	filter "options:with-zstd"
+		defines { "MICRO_VULKAN_USE_ZSTD" }
+		links { "zstd" }
+
+	-- XXHASH
+	filter "options:with-xxhash"
+		defines { "MICRO_VULKAN_USE_XXHASH" }
+		links { "xxhash" }
+
 	--- CONFIGURATION
 	filter "configurations:Debug"
 		runtime "Debug"
@@ -11,7 +11,9 @@ project "Spirv"
 	--- GLOBAL SOURCE FILES
 	files { 
 		"%{IncludeDirs.Vulkan}Include/spirv-headers/**.h",
-		"%{IncludeDirs.Vulkan}Include/spirv-headers/**.hpp"
+		"%{IncludeDirs.Vulkan}Include/spirv-headers/**.hpp",
+		"%{IncludeDirs.Vulkan}Include/spirv-tools/**.h",
+		"%{IncludeDirs.Vulkan}Include/spirv-tools/**.hpp"
 	}
 
 	--- WINDOWS
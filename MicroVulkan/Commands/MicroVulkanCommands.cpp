@@ -35,7 +35,8 @@
 //		===	PUBLIC ===
 ////////////////////////////////////////////////////////////////////////////////////////////
 MicroVulkanCommands::MicroVulkanCommands( ) 
-	: m_pools{ }
+	: m_pools{ },
+	m_uploads{ }
 { }
 
 bool MicroVulkanCommands::Create(
@@ -62,16 +63,57 @@ bool MicroVulkanCommands::Create(
 		type += 1;
 	}
 
+	if ( state ) {
+		auto pool_spec = MicroVulkanCommandPoolSpecification{ };
+
+		pool_spec.QueueFamily	 = queues.GetQueueFamily( vk::QUEUE_TYPE_GRAPHICS );
+		pool_spec.PrimayCount	 = UPLOAD_COUNT;
+		pool_spec.SecondaryCount = 0;
+
+		state = CreateCommandPool( device, pool_spec, m_uploads ) &&
+				CreateCommandBuffers( device, VK_COMMAND_BUFFER_LEVEL_PRIMARY, 0, pool_spec.PrimayCount, m_uploads );
+	}
+
 	return state;
 }
 
 MicroVulkanCommandHandle MicroVulkanCommands::Acquire(
 	vk::QueueTypes queue_type, 
 	VkCommandBufferLevel level 
+) {
+	return Acquire( m_pools[ queue_type ], queue_type, level );
+}
+
+void MicroVulkanCommands::Release( MicroVulkanCommandHandle& handle ) {
+	if ( handle.GetIsValid( ) )
+		Release( m_pools[ handle.Type ], handle );
+}
+
+MicroVulkanCommandHandle MicroVulkanCommands::AcquireUpload( ) {
+	return Acquire( m_uploads, vk::QUEUE_TYPE_GRAPHICS, VK_COMMAND_BUFFER_LEVEL_PRIMARY );
+}
+
+void MicroVulkanCommands::ReleaseUpload( MicroVulkanCommandHandle& handle ) {
+	Release( m_uploads, handle );
+}
+
+void MicroVulkanCommands::Destroy( const MicroVulkanDevice& device ) {
+	for ( auto& pair : m_pools )
+		Destroy( device, pair.second );
+
+	Destroy( device, m_uploads );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+MicroVulkanCommandHandle MicroVulkanCommands::Acquire(
+	MicroVulkanCommandPool& pool,
+	vk::QueueTypes queue_type,
+	VkCommandBufferLevel level
 ) {
 	auto buffer_id = (uint32_t)0;
 	auto handle	   = MicroVulkanCommandHandle{ };
-	auto& pool	   = m_pools[ queue_type ];
 
 	for ( auto& buffer : pool.Buffers ) {
 		if ( buffer.InUse == VK_TRUE || buffer.Level != level )
@@ -91,10 +133,11 @@ MicroVulkanCommandHandle MicroVulkanCommands::Acquire(
 	return handle;
 }
 
-void MicroVulkanCommands::Release( MicroVulkanCommandHandle& handle ) {
+void MicroVulkanCommands::Release(
+	MicroVulkanCommandPool& pool,
+	MicroVulkanCommandHandle& handle
+) {
 	if ( handle.GetIsValid( ) ) {
-		auto& pool = m_pools[ handle.Type ];
-
 		pool.Buffers[ handle.BufferID ].InUse = VK_FALSE;
 
 		handle.BufferID = UINT32_MAX;
@@ -102,25 +145,21 @@ void MicroVulkanCommands::Release( MicroVulkanCommandHandle& handle ) {
 	}
 }
 
-void MicroVulkanCommands::Destroy( const MicroVulkanDevice& device ) {
-	for ( auto& pair : m_pools ) {
-		auto& pool = pair.second;
-
-		if ( vk::IsValid( pool.Pool ) ) {
-			auto buffer_list  = EnumerateCommandBuffer( pool );
-			auto buffer_count = (uint32_t)buffer_list.size( );
-			auto* buffer_data = buffer_list.data( );
-
-			vkFreeCommandBuffers( device, pool, buffer_count, buffer_data );
-		}
+void MicroVulkanCommands::Destroy(
+	const MicroVulkanDevice& device,
+	MicroVulkanCommandPool& pool
+) {
+	if ( vk::IsValid( pool.Pool ) ) {
+		auto buffer_list  = EnumerateCommandBuffer( pool );
+		auto buffer_count = (uint32_t)buffer_list.size( );
+		auto* buffer_data = buffer_list.data( );
 
-		vk::DestroyCommandPool( device, pool );
+		vkFreeCommandBuffers( device, pool, buffer_count, buffer_data );
 	}
+
+	vk::DestroyCommandPool( device, pool );
 }
 
-////////////////////////////////////////////////////////////////////////////////////////////
-//		===	PRIVATE ===
-////////////////////////////////////////////////////////////////////////////////////////////
 MicroVulkanCommandPoolSpecification MicroVulkanCommands::CreateCommandPoolSpec(
 	const MicroVulkanQueues& queues,
 	const MicroVulkanSwapchain& swapchain,
@@ -35,8 +35,11 @@
 
 micro_class MicroVulkanCommands final { 
 
+	constexpr static uint32_t UPLOAD_COUNT = 4;
+
 private:
 	std::map<vk::QueueTypes, MicroVulkanCommandPool> m_pools;
+	MicroVulkanCommandPool m_uploads;
 
 public:
 	MicroVulkanCommands( );
@@ -53,9 +56,29 @@ public:
 
 	void Release( MicroVulkanCommandHandle& handle );
 
+	/**
+	 * AcquireUpload function
+	 * @note : Upload buffers come from their own graphics pool, pending
+	 *		   uploads never take a buffer from the frames.
+	 * @return MicroVulkanCommandHandle
+	 **/
+	MicroVulkanCommandHandle AcquireUpload( );
+
+	void ReleaseUpload( MicroVulkanCommandHandle& handle );
+
 	void Destroy( const MicroVulkanDevice& device );
 
 private:
+	MicroVulkanCommandHandle Acquire(
+		MicroVulkanCommandPool& pool,
+		vk::QueueTypes queue_type,
+		VkCommandBufferLevel level
+	);
+
+	void Release( MicroVulkanCommandPool& pool, MicroVulkanCommandHandle& handle );
+
+	void Destroy( const MicroVulkanDevice& device, MicroVulkanCommandPool& pool );
+
 	MicroVulkanCommandPoolSpecification CreateCommandPoolSpec(
 		const MicroVulkanQueues& queues,
 		const MicroVulkanSwapchain& swapchain,
@@ -35,10 +35,25 @@
 //		===	PUBLIC ===
 ////////////////////////////////////////////////////////////////////////////////////////////
 MicroVulkanCompiler::MicroVulkanCompiler( )
-	: m_compiler{ },
-	m_options{ }
+	: MicroVulkanCompiler{ "" }
 { }
 
+MicroVulkanCompiler::MicroVulkanCompiler( const std::string& cache_path )
+	: m_compiler{ },
+	m_options{ },
+	m_checksum{ },
+	m_macros{ },
+	m_cache_path{ cache_path },
+	m_dependencies{ },
+	m_dependents{ },
+	m_mutex{ }
+{
+	auto error = std::error_code{ };
+
+	if ( !m_cache_path.empty( ) )
+		std::filesystem::create_directories( m_cache_path, error );
+}
+
 void MicroVulkanCompiler::Register( const MicroVulkanCompilerMacro& macro ) {
 	Register( macro.Name, macro.Value );
 }
@@ -57,6 +72,10 @@ void MicroVulkanCompiler::Register( micro_string name, micro_string value ) {
 	if ( name_length == 0 || value_length == 0 )
 		return;
 
+	// Global macros are baked into m_options, their hash is kept aside so
+	// cached results compiled with other definitions are never reused.
+	m_macros.Combine( std::string{ name } );
+	m_macros.Combine( std::string{ value } );
 	m_options.AddMacroDefinition( name, name_length, value, value_length );
 }
 
@@ -82,81 +101,534 @@ MicroVulkanCompilerResult MicroVulkanCompiler::Compile(
 	micro_string code,
 	const uint32_t length
 ) {
-	auto result = MicroVulkanCompilerResult{ };
-
-	return result;
+	return CompileSource( m_compiler, specification, code, length );
 }
 
 MicroVulkanCompilerResult MicroVulkanCompiler::CompileFile(
 	const MicroVulkanCompilerSpecification& specification,
 	const std::string path
+) {
+	return CompilePath( m_compiler, specification, path );
+}
+
+std::vector<std::shared_future<MicroVulkanCompilerResult>> MicroVulkanCompiler::Compile(
+	MicroVulkanWorkerPool& workers,
+	const std::vector<MicroVulkanCompilerJob>& jobs
+) {
+	auto results  = std::vector<std::shared_future<MicroVulkanCompilerResult>>{ };
+	auto pendings = std::unordered_map<uint64_t, std::shared_future<MicroVulkanCompilerResult>>{ };
+
+	results.reserve( jobs.size( ) );
+
+	// Identical jobs share the same future, each one is compiled once. Tasks
+	// own a copy of their job and the compiler must outlive the futures.
+	for ( const auto& job : jobs ) {
+		auto hash	 = CreateJobHash( job );
+		auto pending = pendings.find( hash );
+
+		if ( pending == pendings.end( ) ) {
+			auto task = [ this, job ]( ) {
+				// Every worker keeps its own shaderc::Compiler, jobs running
+				// on different threads never share compiler state.
+				thread_local auto compiler = shaderc::Compiler{ };
+
+				return CompileJob( compiler, job );
+			};
+
+			pending = pendings.emplace( hash, workers.Dispatch( std::move( task ) ).share( ) ).first;
+		}
+
+		results.emplace_back( pending->second );
+	}
+
+	return results;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint64_t MicroVulkanCompiler::CreateHash(
+	const MicroVulkanCompilerSpecification& specification,
+	micro_string code,
+	const uint32_t length
+) const {
+	auto hash		  = MicroVulkanHash{ };
+	auto spv_version  = 0u;
+	auto spv_revision = 0u;
+
+	// The header version doesn't follow toolchain updates, the SDK release the
+	// build links shaderc and glslang from does.
+	shaderc_get_spv_version( micro_ptr( spv_version ), micro_ptr( spv_revision ) );
+
+	hash.Combine( CACHE_VERSION );
+	hash.Combine( std::string{ MICRO_VULKAN_SDK_VERSION } );
+	hash.Combine( VK_HEADER_VERSION_COMPLETE );
+	hash.Combine( spv_version );
+	hash.Combine( spv_revision );
+	hash.Combine( m_macros.Get( ) );
+	hash.Combine( specification.Language );
+	hash.Combine( specification.Optimization );
+	hash.Combine( specification.Recipe.DeadCode );
+	hash.Combine( specification.Recipe.Inline );
+	hash.Combine( specification.Recipe.UnrollLoops );
+	hash.Combine( specification.Recipe.StripDebug );
+	hash.Combine( specification.Target );
+	hash.Combine( specification.Environment );
+	hash.Combine( specification.Name );
+	hash.Combine( specification.Entry );
+	hash.Combine( (uint64_t)specification.Macros.size( ) );
+
+	for ( const auto& macro : specification.Macros ) {
+		hash.Combine( std::string{ macro.Name } );
+		hash.Combine( std::string{ macro.Value } );
+	}
+
+	hash.Combine( (uint64_t)specification.Includes.size( ) );
+
+	for ( const auto& include : specification.Includes )
+		hash.Combine( include );
+
+	hash.Combine( code, length );
+
+	return hash;
+}
+
+uint64_t MicroVulkanCompiler::CreatePathHash(
+	const MicroVulkanCompilerSpecification& specification,
+	const std::string& path
+) const {
+	auto hash = MicroVulkanHash{ };
+
+	// Files are keyed by path alone, their content is checked through the
+	// dependency stamps so an unchanged shader is never read or hashed.
+	hash.Combine( CreateHash( specification, "", 0 ) );
+	hash.Combine( path );
+
+	return hash;
+}
+
+uint64_t MicroVulkanCompiler::CreateJobHash( const MicroVulkanCompilerJob& job ) const {
+	const auto* code  = job.Source.c_str( );
+	const auto length = (uint32_t)job.Source.size( );
+	auto hash		  = MicroVulkanHash{ };
+
+	hash.Combine( job.Path );
+	hash.Combine( CreateHash( job.Specification, code, length ) );
+
+	return hash;
+}
+
+shaderc::CompileOptions MicroVulkanCompiler::CreateOptions(
+	const MicroVulkanCompilerSpecification& specification,
+	std::vector<MicroVulkanCompilerDependency>* dependencies
+) const {
+	auto options  = shaderc::CompileOptions{ m_options };
+	auto includer = std::make_unique<MicroVulkanCompilerIncluder>( specification.Includes, dependencies );
+
+	options.SetIncluder( std::move( includer ) );
+
+	options.SetSourceLanguage( shaderc_source_language_glsl );
+
+	switch ( specification.Optimization ) {
+		case MicroVulkanCompilerOptimization::Size : options.SetOptimizationLevel( shaderc_optimization_level_size ); break;
+		case MicroVulkanCompilerOptimization::Zero : options.SetOptimizationLevel( shaderc_optimization_level_zero ); break;
+
+		default : options.SetOptimizationLevel( shaderc_optimization_level_performance ); break;
+	}
+
+	if ( specification.Environment == MicroVulkanCompilerEnvironment::OpenGL )
+		options.SetTargetEnvironment( shaderc_target_env_opengl, shaderc_env_version_opengl_4_5 );
+	else
+		options.SetTargetEnvironment( shaderc_target_env_vulkan, shaderc_env_version_vulkan_1_3 );
+
+	for ( const auto& macro : specification.Macros ) {
+		const auto name_length	= strlen( macro.Name );
+		const auto value_length = strlen( macro.Value );
+
+		options.AddMacroDefinition( macro.Name, name_length, macro.Value, value_length );
+	}
+
+	return options;
+}
+
+MicroVulkanCompilerResult MicroVulkanCompiler::CompileSource(
+	const shaderc::Compiler& compiler,
+	const MicroVulkanCompilerSpecification& specification,
+	micro_string code,
+	const uint32_t length
 ) {
 	auto result = MicroVulkanCompilerResult{ };
+	auto hash	= CreateHash( specification, code, length );
+
+	if ( !LoadCache( hash, result ) )
+		CompileCode( compiler, specification, hash, code, length, result );
+
+	if ( !specification.Name.empty( ) )
+		RecordDependencies( MicroVulkanCompilerIncluder::CreatePath( specification.Name ), result );
 
 	return result;
 }
 
-/*
-bool ProcessGLSL( const MicroVulkanCompilerSource& source, shaderc::CompileOptions& options  ) {
-	auto* source_str = context.Source.get( );
-	auto source_len  = context.Source.length( );
-	auto* name_str   = context.Name.get( );
-	auto preprocess  = m_compiler.PreprocessGlsl( source_str, source_len, shaderc_glsl_infer_from_source, name_str, options );
-	auto status		 = preprocess.GetCompilationStatus( );
-	
-	if ( status == shaderc_compilation_status_success ) {
-		auto spirv = m_compiler.CompileGlslToSpv( preprocess.begin( ), shaderc_glsl_infer_from_source, name_str, options );
-
-		status = spirv.GetCompilationStatus( );
-		
-		if ( status == shaderc_compilation_status_success ) {
-			auto size = tiny_cast( spirv.end( ) - spirv.begin( ), tiny_uint ) * tiny_sizeof( tiny_uint );
-			
-			specification.Type  = PeekType( context.Source );
-			specification.Entry = context.Entry.as_string( );
-			specification.Code  = size;
-
-			auto* src = spirv.begin( );
-			auto* dst = specification.Code.data( );
-
-			Tiny::Memcpy( src, dst, size );
+MicroVulkanCompilerResult MicroVulkanCompiler::CompilePath(
+	const shaderc::Compiler& compiler,
+	const MicroVulkanCompilerSpecification& specification,
+	const std::string& path
+) {
+	auto root	   = MicroVulkanCompilerIncluder::CreatePath( path );
+	auto file_spec = specification;
+	auto result	   = MicroVulkanCompilerResult{ };
+
+	if ( file_spec.Name.empty( ) )
+		file_spec.Name = root;
+
+	auto hash = CreatePathHash( file_spec, root );
+
+	// The shader itself is its first dependency, editing it invalidates the
+	// entry the same way an edited include does.
+	if ( !LoadCache( hash, result ) ) {
+		auto source		= std::string{ };
+		auto dependency = MicroVulkanCompilerDependency{ };
+
+		if ( MicroVulkanCompilerIncluder::Read( root, source, dependency ) ) {
+			const auto* code  = source.c_str( );
+			const auto length = (uint32_t)source.size( );
+
+			result.Dependencies.emplace_back( std::move( dependency ) );
+
+			CompileCode( compiler, file_spec, hash, code, length, result );
 		} else
-			printf( "[ VK ] Shader Compilation Error : %s\n%s\n", name_str, spirv.GetErrorMessage( ).c_str( ) );
-	} else 
-		printf( "[ VK ] Shader Compilation Error : %s\n%s\n", name_str, preprocess.GetErrorMessage( ).c_str( ) );
+			result.Error = std::format( "Can't read shader {}", root );
+	}
+
+	RecordDependencies( root, result );
 
-	return status == shaderc_compilation_status_success;
+	return result;
 }
 
-bool ProcessHLSL( const MicroVulkanCompilerSource& source, shaderc::CompileOptions& options ) {
+MicroVulkanCompilerResult MicroVulkanCompiler::CompileJob(
+	const shaderc::Compiler& compiler,
+	const MicroVulkanCompilerJob& job
+) {
+	if ( !job.Path.empty( ) )
+		return CompilePath( compiler, job.Specification, job.Path );
+
+	const auto* code  = job.Source.c_str( );
+	const auto length = (uint32_t)job.Source.size( );
 
-	return false;
+	return CompileSource( compiler, job.Specification, code, length );
 }
 
-bool d( const MicroVulkanCompilerSource& source ) {
-	// OPTIONS
-	auto options = shaderc::CompileOptions{ m_options };
-	auto result  = false;
+void MicroVulkanCompiler::CompileCode(
+	const shaderc::Compiler& compiler,
+	const MicroVulkanCompilerSpecification& specification,
+	const uint64_t hash,
+	micro_string code,
+	const uint32_t length,
+	MicroVulkanCompilerResult& result
+) const {
+	auto options = CreateOptions( specification, micro_ptr( result.Dependencies ) );
+	auto success = false;
 
-	options.SetSourceLanguage( shaderc_source_language_glsl ); // source.Language
-	options.SetOptimizationLevel( shaderc_optimization_level_performance ); // source.Optimization
-	options.SetTargetEnvironment( shaderc_target_env_vulkan, shaderc_env_version_vulkan_1_3 ); //source.Environment
+	// HLSL needs the shader kind up front while specifications only carry
+	// the source, it's refused instead of failing without an error.
+	switch ( specification.Language ) {
+		case MicroVulkanCompilerLanguage::GLSL : success = CompileGLSL( compiler, specification, options, code, length, result ); break;
+		case MicroVulkanCompilerLanguage::HLSL : result.Error = "HLSL is not supported"; break;
 
-	for ( const auto& macro : source.Macros ) {
-		const auto name_length  = strlen( macro.Name );
-		const auto value_length = strlen( macro.Value );
+		default : result.Error = "Unknown shader language"; break;
+	}
+
+	if ( success )
+		SaveCache( hash, result );
+}
+
+bool MicroVulkanCompiler::CompileGLSL(
+	const shaderc::Compiler& compiler,
+	const MicroVulkanCompilerSpecification& specification,
+	const shaderc::CompileOptions& options,
+	micro_string code,
+	const uint32_t length,
+	MicroVulkanCompilerResult& result
+) const {
+	const auto* name  = specification.Name.c_str( );
+	const auto* entry = specification.Entry.empty( ) ? "main" : specification.Entry.c_str( );
+	const auto kind	  = shaderc_glsl_infer_from_source;
 
-		options.AddMacroDefinition( macro.Name, name_length, macro.Value, value_length );	
+	if ( specification.Target == MicroVulkanCompilerTargetType::Assembler ) {
+		auto assembly = compiler.CompileGlslToSpvAssembly( code, length, kind, name, entry, options );
+
+		if ( assembly.GetCompilationStatus( ) != shaderc_compilation_status_success ) {
+			result.Error = assembly.GetErrorMessage( );
+
+			return false;
+		}
+
+		result.Output.assign( assembly.cbegin( ), assembly.cend( ) );
+
+		return true;
 	}
 
-	// COMPILATION
-	switch ( source.Language ) {
-		case MicroVulkanCompilerLanguage::GLSL : result = ProcessGLSL( source, options ); break;
-		case MicroVulkanCompilerLanguage::HLSL : result = ProcessHLSL( source, options ); break;
+	auto spirv = compiler.CompileGlslToSpv( code, length, kind, name, entry, options );
+
+	if ( spirv.GetCompilationStatus( ) != shaderc_compilation_status_success ) {
+		result.Error = spirv.GetErrorMessage( );
 
-		default : break;
+		return false;
 	}
 
-	return result;
+	auto* spirv_data = micro_cast( spirv.cbegin( ), const uint8_t* );
+	auto spirv_size	 = (size_t)( spirv.cend( ) - spirv.cbegin( ) ) * sizeof( uint32_t );
+
+	result.Output.assign( spirv_data, spirv_data + spirv_size );
+
+	return CompileRecipe( specification, result );
+}
+
+bool MicroVulkanCompiler::CompileRecipe(
+	const MicroVulkanCompilerSpecification& specification,
+	MicroVulkanCompilerResult& result
+) const {
+	result.Stats.InstructionsBefore = GetInstructionCount( result.Output );
+	result.Stats.SizeBefore			= (uint32_t)result.Output.size( );
+	result.Stats.InstructionsAfter	= result.Stats.InstructionsBefore;
+	result.Stats.SizeAfter			= result.Stats.SizeBefore;
+
+	if ( specification.Recipe.GetIsEmpty( ) )
+		return true;
+
+	auto environment = SPV_ENV_VULKAN_1_3;
+
+	if ( specification.Environment == MicroVulkanCompilerEnvironment::OpenGL )
+		environment = SPV_ENV_OPENGL_4_5;
+
+	auto optimizer = spvtools::Optimizer{ environment };
+	auto* input	   = micro_cast( result.Output.data( ), const uint32_t* );
+	auto length	   = result.Output.size( ) / sizeof( uint32_t );
+	auto output	   = std::vector<uint32_t>{ };
+
+	optimizer.SetMessageConsumer(
+		[ &result ]( spv_message_level_t level, const char*, const spv_position_t&, const char* message ) {
+			if ( level <= SPV_MSG_ERROR )
+				result.Error += std::format( "{}\n", message );
+		}
+	);
+
+	// Inlining comes first so dead code elimination and unrolling see the
+	// flattened functions, debug info is stripped last.
+	if ( specification.Recipe.Inline )
+		optimizer.RegisterPass( spvtools::CreateInlineExhaustivePass( ) );
+
+	if ( specification.Recipe.UnrollLoops )
+		optimizer.RegisterPass( spvtools::CreateLoopUnrollPass( true ) );
+
+	if ( specification.Recipe.DeadCode ) {
+		optimizer.RegisterPass( spvtools::CreateDeadBranchElimPass( ) );
+		optimizer.RegisterPass( spvtools::CreateAggressiveDCEPass( ) );
+		optimizer.RegisterPass( spvtools::CreateEliminateDeadFunctionsPass( ) );
+	}
+
+	if ( specification.Recipe.StripDebug )
+		optimizer.RegisterPass( spvtools::CreateStripDebugInfoPass( ) );
+
+	if ( !optimizer.Run( input, length, micro_ptr( output ) ) ) {
+		result.Output.clear( );
+
+		return false;
+	}
+
+	auto* output_data = micro_cast( output.data( ), const uint8_t* );
+	auto output_size  = output.size( ) * sizeof( uint32_t );
+
+	result.Output.assign( output_data, output_data + output_size );
+
+	result.Stats.InstructionsAfter = GetInstructionCount( result.Output );
+	result.Stats.SizeAfter		   = (uint32_t)result.Output.size( );
+
+	return true;
+}
+
+bool MicroVulkanCompiler::LoadCache( const uint64_t hash, MicroVulkanCompilerResult& result ) const {
+	if ( m_cache_path.empty( ) )
+		return false;
+
+	auto file = MicroVulkanMappedFile{ };
+
+	if ( !file.Open( GetCachePath( hash ) ) )
+		return false;
+
+	auto* header_data = file.GetData( 0, sizeof( MicroVulkanCompilerCacheHeader ) );
+
+	if ( header_data == nullptr )
+		return false;
+
+	auto& header = micro_ref_as( header_data, const MicroVulkanCompilerCacheHeader );
+
+	if ( header.Magic != CACHE_MAGIC || header.Version != CACHE_VERSION || header.Hash != hash )
+		return false;
+
+	auto* payload = file.GetData( sizeof( MicroVulkanCompilerCacheHeader ), header.Length );
+
+	if ( payload == nullptr || m_checksum.CRC32( payload, header.Length ) != header.CRC )
+		return false;
+
+	auto blob		= MicroVulkanBlob{ payload, header.Length };
+	auto count		= (uint32_t)0;
+	auto is_touched = false;
+	auto is_current = blob.Read( result.Output ) && blob.Read( result.Stats ) && blob.Read( count );
+
+	while ( is_current && count-- > 0 ) {
+		auto& dependency = result.Dependencies.emplace_back( );
+
+		is_current = blob.Read( dependency.Path ) &&
+					 blob.Read( dependency.Time ) &&
+					 blob.Read( dependency.Size ) &&
+					 blob.Read( dependency.Hash ) &&
+					 MicroVulkanCompilerIncluder::GetIsCurrent( dependency, is_touched );
+	}
+
+	// Only the entries whose dependency changed are compiled again. A touched
+	// but unchanged file is stamped again so it's only hashed once.
+	if ( !is_current ) {
+		result.Output.clear( );
+		result.Dependencies.clear( );
+
+		return false;
+	}
+
+	if ( is_touched )
+		SaveCache( hash, result );
+
+	return true;
+}
+
+void MicroVulkanCompiler::SaveCache( const uint64_t hash, const MicroVulkanCompilerResult& result ) const {
+	if ( m_cache_path.empty( ) )
+		return;
+
+	auto path	   = GetCachePath( hash );
+	auto temp_path = std::format( "{}.{}.tmp", path, std::hash<std::thread::id>{ }( std::this_thread::get_id( ) ) );
+	auto header	   = MicroVulkanCompilerCacheHeader{ };
+	auto* file	   = micro_cast( NULL, FILE* );
+	auto success   = false;
+	auto blob	   = MicroVulkanBlob{ };
+
+	blob.Write( result.Output );
+	blob.Write( result.Stats );
+	blob.Write( (uint32_t)result.Dependencies.size( ) );
+
+	for ( const auto& dependency : result.Dependencies ) {
+		blob.Write( dependency.Path );
+		blob.Write( dependency.Time );
+		blob.Write( dependency.Size );
+		blob.Write( dependency.Hash );
+	}
+
+	auto& payload = blob.Get( );
+
+	header.Magic   = CACHE_MAGIC;
+	header.Version = CACHE_VERSION;
+	header.Hash	   = hash;
+	header.Length  = (uint64_t)payload.size( );
+	header.CRC	   = m_checksum.CRC32( payload.data( ), payload.size( ) );
+
+#	ifdef _WIN32
+	if ( fopen_s( micro_ptr( file ), temp_path.c_str( ), "wb" ) != 0 )
+		file = NULL;
+#	else
+	file = fopen( temp_path.c_str( ), "wb" );
+#	endif
+
+	if ( file == NULL )
+		return;
+
+	success = fwrite( micro_ptr( header ), sizeof( MicroVulkanCompilerCacheHeader ), 1, file ) == 1 &&
+			  fwrite( payload.data( ), sizeof( uint8_t ), payload.size( ), file ) == payload.size( );
+
+	fclose( file );
+
+	// Entries are not synced to disk, a torn entry fails its CRC on load and
+	// is simply compiled again.
+	if ( success ) {
+		auto error = std::error_code{ };
+
+		std::filesystem::rename( temp_path, path, error );
+
+		success = !error;
+	}
+
+	if ( !success )
+		std::filesystem::remove( temp_path );
+}
+
+void MicroVulkanCompiler::RecordDependencies(
+	const std::string& root,
+	const MicroVulkanCompilerResult& result
+) {
+	auto lock	   = std::unique_lock{ m_mutex };
+	auto& includes = m_dependencies[ root ];
+
+	// Edges of the previous compile are dropped first, a shader that stopped
+	// including a file must not be recompiled when it changes.
+	for ( const auto& include : includes )
+		m_dependents[ include ].erase( root );
+
+	includes.clear( );
+
+	for ( const auto& dependency : result.Dependencies ) {
+		includes.emplace_back( dependency.Path );
+
+		m_dependents[ dependency.Path ].emplace( root );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+std::vector<std::string> MicroVulkanCompiler::GetDependencies( const std::string& path ) const {
+	auto lock	  = std::unique_lock{ m_mutex };
+	auto includes = m_dependencies.find( MicroVulkanCompilerIncluder::CreatePath( path ) );
+
+	if ( includes == m_dependencies.end( ) )
+		return { };
+
+	return includes->second;
+}
+
+std::vector<std::string> MicroVulkanCompiler::GetDependents( const std::string& path ) const {
+	auto lock	 = std::unique_lock{ m_mutex };
+	auto shaders = m_dependents.find( MicroVulkanCompilerIncluder::CreatePath( path ) );
+
+	if ( shaders == m_dependents.end( ) )
+		return { };
+
+	return { shaders->second.begin( ), shaders->second.end( ) };
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+std::string MicroVulkanCompiler::GetCachePath( const uint64_t hash ) const {
+	return std::format( "{}/{:016x}.spv", m_cache_path, hash );
+}
+
+uint32_t MicroVulkanCompiler::GetInstructionCount( const std::vector<uint8_t>& output ) {
+	const auto* code = micro_cast( output.data( ), const uint32_t* );
+	const auto size	 = output.size( ) / sizeof( uint32_t );
+	auto word_id	 = (size_t)SPIRV_HEADER;
+	auto count		 = (uint32_t)0;
+
+	if ( size < SPIRV_HEADER || code[ 0 ] != SPIRV_MAGIC )
+		return 0;
+
+	while ( word_id < size ) {
+		auto word_count = (size_t)( code[ word_id ] >> 16 );
+
+		if ( word_count == 0 )
+			break;
+
+		word_id += word_count;
+		count	+= 1;
+	}
+
+	return count;
 }
-*/
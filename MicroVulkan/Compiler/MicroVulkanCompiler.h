@@ -31,7 +31,15 @@
 
 #pragma once
 
-#include "../MicroVulkan.h"
+#include "MicroVulkanCompilerIncluder.h"
+
+/**
+ * MICRO_VULKAN_SDK_VERSION macro
+ * @note : Defined by the build from the SDK shaderc and glslang ship with.
+ **/
+#ifndef MICRO_VULKAN_SDK_VERSION
+#	define MICRO_VULKAN_SDK_VERSION ""
+#endif
 
 micro_struct MicroVulkanCompilerMacro {
 
@@ -50,6 +58,8 @@ micro_enum_class MicroVulkanCompilerLanguage : uint32_t {
 micro_enum_class MicroVulkanCompilerOptimization : uint32_t {
 
 	Performance = 0,
+	Size,
+	Zero
 
 };
 
@@ -67,28 +77,63 @@ micro_enum_class MicroVulkanCompilerEnvironment : uint32_t {
 
 };
 
+micro_struct MicroVulkanCompilerRecipe {
+
+	bool DeadCode;
+	bool Inline;
+	bool UnrollLoops;
+	bool StripDebug;
+
+	bool GetIsEmpty( ) const {
+		return !DeadCode && !Inline && !UnrollLoops && !StripDebug;
+	};
+
+};
+
 micro_struct MicroVulkanCompilerSpecification {
 
 	MicroVulkanCompilerLanguage Language;
 	MicroVulkanCompilerOptimization Optimization;
+	MicroVulkanCompilerRecipe Recipe;
 	MicroVulkanCompilerTargetType Target;
 	MicroVulkanCompilerEnvironment Environment;
 	std::vector<MicroVulkanCompilerMacro> Macros;
+	std::string Name;
+	std::string Entry;
+	std::vector<std::string> Includes;
+
+};
+
+micro_struct MicroVulkanCompilerStats {
+
+	uint32_t InstructionsBefore;
+	uint32_t InstructionsAfter;
+	uint32_t SizeBefore;
+	uint32_t SizeAfter;
 
 };
 
 micro_struct MicroVulkanCompilerResult {
 
 	std::vector<uint8_t> Output;
+	std::string Error;
+	std::vector<MicroVulkanCompilerDependency> Dependencies;
+	MicroVulkanCompilerStats Stats;
 
 	MicroVulkanCompilerResult( )
-		: Output{ } 
+		: Output{ },
+		Error{ },
+		Dependencies{ },
+		Stats{ }
 	{ };
 
 	MicroVulkanCompilerResult(
 		MicroVulkanCompilerResult&& other
 	) noexcept 
-		: Output{ std::move( other.Output ) }
+		: Output{ std::move( other.Output ) },
+		Error{ std::move( other.Error ) },
+		Dependencies{ std::move( other.Dependencies ) },
+		Stats{ other.Stats }
 	{ };
 
 	bool GetIsValid( ) const {
@@ -101,15 +146,36 @@ micro_struct MicroVulkanCompilerResult {
 
 };
 
+micro_struct MicroVulkanCompilerJob {
+
+	MicroVulkanCompilerSpecification Specification;
+	std::string Source;
+	std::string Path;
+
+};
+
 micro_class MicroVulkanCompiler final {
 
+	constexpr static uint32_t CACHE_MAGIC	= 0x4353564D;
+	constexpr static uint32_t CACHE_VERSION = 3;
+	constexpr static uint32_t SPIRV_MAGIC	= 0x07230203;
+	constexpr static uint32_t SPIRV_HEADER	= 5;
+
 private:
 	shaderc::Compiler m_compiler;
 	shaderc::CompileOptions m_options;
+	MicroVulkanChecksum m_checksum;
+	MicroVulkanHash m_macros;
+	std::string m_cache_path;
+	std::unordered_map<std::string, std::vector<std::string>> m_dependencies;
+	std::unordered_map<std::string, std::set<std::string>> m_dependents;
+	mutable std::mutex m_mutex;
 
 public:
 	MicroVulkanCompiler( );
 
+	MicroVulkanCompiler( const std::string& cache_path );
+
 	~MicroVulkanCompiler( ) = default;
 
 	void Register( const MicroVulkanCompilerMacro& macro );
@@ -136,4 +202,96 @@ public:
 		const std::string path
 	);
 
+	std::vector<std::shared_future<MicroVulkanCompilerResult>> Compile(
+		MicroVulkanWorkerPool& workers,
+		const std::vector<MicroVulkanCompilerJob>& jobs
+	);
+
+private:
+	uint64_t CreateHash(
+		const MicroVulkanCompilerSpecification& specification,
+		micro_string code,
+		const uint32_t length
+	) const;
+
+	uint64_t CreatePathHash(
+		const MicroVulkanCompilerSpecification& specification,
+		const std::string& path
+	) const;
+
+	uint64_t CreateJobHash( const MicroVulkanCompilerJob& job ) const;
+
+	shaderc::CompileOptions CreateOptions(
+		const MicroVulkanCompilerSpecification& specification,
+		std::vector<MicroVulkanCompilerDependency>* dependencies
+	) const;
+
+	MicroVulkanCompilerResult CompileSource(
+		const shaderc::Compiler& compiler,
+		const MicroVulkanCompilerSpecification& specification,
+		micro_string code,
+		const uint32_t length
+	);
+
+	MicroVulkanCompilerResult CompilePath(
+		const shaderc::Compiler& compiler,
+		const MicroVulkanCompilerSpecification& specification,
+		const std::string& path
+	);
+
+	MicroVulkanCompilerResult CompileJob(
+		const shaderc::Compiler& compiler,
+		const MicroVulkanCompilerJob& job
+	);
+
+	void CompileCode(
+		const shaderc::Compiler& compiler,
+		const MicroVulkanCompilerSpecification& specification,
+		const uint64_t hash,
+		micro_string code,
+		const uint32_t length,
+		MicroVulkanCompilerResult& result
+	) const;
+
+	bool CompileGLSL(
+		const shaderc::Compiler& compiler,
+		const MicroVulkanCompilerSpecification& specification,
+		const shaderc::CompileOptions& options,
+		micro_string code,
+		const uint32_t length,
+		MicroVulkanCompilerResult& result
+	) const;
+
+	/**
+	 * CompileRecipe function
+	 * @note : Run the spirv-opt passes selected by the specification recipe
+	 *		   on a binary output, instruction counts are kept in the stats.
+	 * @param specification : Query compiler specification.
+	 * @param result : Query result holding the shaderc output.
+	 * @return bool
+	 **/
+	bool CompileRecipe(
+		const MicroVulkanCompilerSpecification& specification,
+		MicroVulkanCompilerResult& result
+	) const;
+
+	bool LoadCache( const uint64_t hash, MicroVulkanCompilerResult& result ) const;
+
+	void SaveCache( const uint64_t hash, const MicroVulkanCompilerResult& result ) const;
+
+	void RecordDependencies(
+		const std::string& root,
+		const MicroVulkanCompilerResult& result
+	);
+
+public:
+	std::vector<std::string> GetDependencies( const std::string& path ) const;
+
+	std::vector<std::string> GetDependents( const std::string& path ) const;
+
+private:
+	std::string GetCachePath( const uint64_t hash ) const;
+
+	static uint32_t GetInstructionCount( const std::vector<uint8_t>& output );
+
 };
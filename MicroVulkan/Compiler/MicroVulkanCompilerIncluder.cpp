@@ -0,0 +1,198 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "__micro_vulkan_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+MicroVulkanCompilerDependency::MicroVulkanCompilerDependency( )
+	: Path{ },
+	Time{ 0 },
+	Size{ 0 },
+	Hash{ 0 }
+{ }
+
+MicroVulkanCompilerInclude::MicroVulkanCompilerInclude( )
+	: Path{ },
+	Content{ },
+	Result{ }
+{ }
+
+MicroVulkanCompilerIncluder::MicroVulkanCompilerIncluder(
+	const std::vector<std::string>& directories,
+	std::vector<MicroVulkanCompilerDependency>* dependencies
+)
+	: m_directories{ directories },
+	m_dependencies{ dependencies }
+{ }
+
+shaderc_include_result* MicroVulkanCompilerIncluder::GetInclude(
+	const char* requested_source,
+	shaderc_include_type type,
+	const char* requesting_source,
+	size_t include_depth
+) {
+	auto* include	= new MicroVulkanCompilerInclude{ };
+	auto dependency = MicroVulkanCompilerDependency{ };
+
+	include->Path = CreatePath( requested_source, type, requesting_source );
+
+	// shaderc reports a failed include through an empty source name, the
+	// content then holds the error message.
+	if ( !include->Path.empty( ) && Read( include->Path, include->Content, dependency ) ) {
+		auto found = std::find_if(
+			m_dependencies->begin( ),
+			m_dependencies->end( ),
+			[ & ]( const auto& other ) { return other.Path == dependency.Path; }
+		);
+
+		if ( found == m_dependencies->end( ) )
+			m_dependencies->emplace_back( std::move( dependency ) );
+	} else {
+		include->Content = std::format( "Can't resolve include {}", requested_source );
+		include->Path.clear( );
+	}
+
+	include->Result.source_name		   = include->Path.c_str( );
+	include->Result.source_name_length = include->Path.size( );
+	include->Result.content			   = include->Content.c_str( );
+	include->Result.content_length	   = include->Content.size( );
+	include->Result.user_data		   = include;
+
+	return micro_ptr( include->Result );
+}
+
+void MicroVulkanCompilerIncluder::ReleaseInclude( shaderc_include_result* data ) {
+	if ( data != nullptr )
+		delete micro_cast( data->user_data, MicroVulkanCompilerInclude* );
+}
+
+bool MicroVulkanCompilerIncluder::Read(
+	const std::string& path,
+	std::string& content,
+	MicroVulkanCompilerDependency& dependency
+) {
+	auto file  = MicroVulkanMappedFile{ };
+	auto error = std::error_code{ };
+	auto time  = std::filesystem::last_write_time( path, error );
+	auto hash  = MicroVulkanHash{ };
+
+	if ( error || !std::filesystem::is_regular_file( path, error ) )
+		return false;
+
+	// Empty files can't be mapped but are still valid sources.
+	content.clear( );
+
+	if ( file.Open( path ) )
+		content.assign( micro_cast( file.GetData( ), micro_string ), (size_t)file.GetSize( ) );
+	else if ( std::filesystem::file_size( path, error ) > 0 || error )
+		return false;
+
+	hash.Combine( content.data( ), content.size( ) );
+
+	dependency.Path = path;
+	dependency.Time = (int64_t)time.time_since_epoch( ).count( );
+	dependency.Size = (uint64_t)content.size( );
+	dependency.Hash = hash;
+
+	return true;
+}
+
+std::string MicroVulkanCompilerIncluder::CreatePath( const std::string& path ) {
+	auto error		= std::error_code{ };
+	auto normalized = std::filesystem::weakly_canonical( path, error );
+
+	if ( error )
+		return std::filesystem::path{ path }.lexically_normal( ).generic_string( );
+
+	return normalized.generic_string( );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+std::string MicroVulkanCompilerIncluder::CreatePath(
+	micro_string requested_source,
+	const shaderc_include_type type,
+	micro_string requesting_source
+) const {
+	auto error = std::error_code{ };
+
+	// Quoted includes look next to the including file first, every include
+	// then falls back to the specification directories in order.
+	if ( type == shaderc_include_type_relative ) {
+		auto parent	   = std::filesystem::path{ requesting_source }.parent_path( );
+		auto candidate = parent / requested_source;
+
+		if ( std::filesystem::is_regular_file( candidate, error ) )
+			return CreatePath( candidate.string( ) );
+	}
+
+	for ( const auto& directory : m_directories ) {
+		auto candidate = std::filesystem::path{ directory } / requested_source;
+
+		if ( std::filesystem::is_regular_file( candidate, error ) )
+			return CreatePath( candidate.string( ) );
+	}
+
+	return { };
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool MicroVulkanCompilerIncluder::GetIsCurrent(
+	MicroVulkanCompilerDependency& dependency,
+	bool& is_touched
+) {
+	auto error = std::error_code{ };
+	auto time  = std::filesystem::last_write_time( dependency.Path, error );
+
+	if ( error || std::filesystem::file_size( dependency.Path, error ) != dependency.Size || error )
+		return false;
+
+	if ( (int64_t)time.time_since_epoch( ).count( ) == dependency.Time )
+		return true;
+
+	auto content = std::string{ };
+	auto stamp	 = MicroVulkanCompilerDependency{ };
+
+	if ( !Read( dependency.Path, content, stamp ) || stamp.Hash != dependency.Hash )
+		return false;
+
+	// Saving the cache again then records the new stamp, so the content is
+	// only hashed once per touch.
+	dependency.Time = stamp.Time;
+	is_touched		= true;
+
+	return true;
+}
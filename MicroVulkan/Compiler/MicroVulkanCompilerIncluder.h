@@ -0,0 +1,119 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "MicroVulkanCompilerCacheHeader.h"
+
+micro_struct MicroVulkanCompilerDependency {
+
+	std::string Path;
+	int64_t Time;
+	uint64_t Size;
+	uint64_t Hash;
+
+	MicroVulkanCompilerDependency( );
+
+};
+
+micro_struct MicroVulkanCompilerInclude {
+
+	std::string Path;
+	std::string Content;
+	shaderc_include_result Result;
+
+	MicroVulkanCompilerInclude( );
+
+};
+
+micro_class MicroVulkanCompilerIncluder final : public shaderc::CompileOptions::IncluderInterface {
+
+private:
+	std::vector<std::string> m_directories;
+	std::vector<MicroVulkanCompilerDependency>* m_dependencies;
+
+public:
+	MicroVulkanCompilerIncluder(
+		const std::vector<std::string>& directories,
+		std::vector<MicroVulkanCompilerDependency>* dependencies
+	);
+
+	~MicroVulkanCompilerIncluder( ) = default;
+
+	shaderc_include_result* GetInclude(
+		const char* requested_source,
+		shaderc_include_type type,
+		const char* requesting_source,
+		size_t include_depth
+	) override;
+
+	void ReleaseInclude( shaderc_include_result* data ) override;
+
+	/**
+	 * Read static function
+	 * @note : Read a source file and stamp it as a dependency, the stamp
+	 *		   is taken before reading so a concurrent edit is never missed.
+	 * @param path : Query normalized source path.
+	 * @param content : Output source content.
+	 * @param dependency : Output dependency stamp.
+	 * @return bool
+	 **/
+	static bool Read(
+		const std::string& path,
+		std::string& content,
+		MicroVulkanCompilerDependency& dependency
+	);
+
+	static std::string CreatePath( const std::string& path );
+
+private:
+	std::string CreatePath(
+		micro_string requested_source,
+		const shaderc_include_type type,
+		micro_string requesting_source
+	) const;
+
+public:
+	/**
+	 * GetIsCurrent static function
+	 * @note : Only stat the file when its stamp matches, content is hashed
+	 *		   again when the stamp moved to tell edits from touches. A
+	 *		   touched dependency takes the new stamp.
+	 * @param dependency : Query recorded dependency.
+	 * @param is_touched : Output true when the stamp moved but not the content.
+	 * @return bool
+	 **/
+	static bool GetIsCurrent(
+		MicroVulkanCompilerDependency& dependency,
+		bool& is_touched
+	);
+
+};
@@ -0,0 +1,418 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "__micro_vulkan_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+MicroVulkanCompilerPermutations::MicroVulkanCompilerPermutations( )
+	: m_checksum{ },
+	m_keywords{ },
+	m_variants{ },
+	m_binaries{ },
+	m_error{ }
+{ }
+
+bool MicroVulkanCompilerPermutations::Create(
+	MicroVulkanWorkerPool& workers,
+	MicroVulkanCompiler& compiler,
+	const MicroVulkanCompilerPermutationSpecification& specification
+) {
+	auto rules = std::vector<MicroVulkanCompilerRuleMask>{ };
+
+	Destroy( );
+
+	if ( !CreateRules( specification, rules ) )
+		return false;
+
+	auto masks	  = CreateMasks( rules );
+	auto jobs	  = std::vector<MicroVulkanCompilerJob>{ };
+	auto binaries = std::unordered_map<uint64_t, std::vector<uint32_t>>{ };
+
+	jobs.reserve( masks.size( ) );
+
+	for ( const auto mask : masks )
+		jobs.emplace_back( CreateJob( specification.Job, mask ) );
+
+	// Macro names point into m_keywords, every future is resolved before
+	// returning so they never outlive it.
+	auto results = compiler.Compile( workers, jobs );
+	auto error	 = std::string{ };
+
+	for ( auto job_id = (size_t)0; job_id < results.size( ); job_id++ ) {
+		auto& result = results[ job_id ].get( );
+
+		if ( !error.empty( ) )
+			continue;
+
+		if ( !result.GetIsValid( ) ) {
+			error = result.Error.empty( ) ? "Permutation failed to compile." : result.Error;
+
+			continue;
+		}
+
+		m_variants[ masks[ job_id ] ] = CreateBinary( binaries, result.Output );
+	}
+
+	if ( !error.empty( ) ) {
+		Destroy( );
+
+		m_error = error;
+	}
+
+	return error.empty( );
+}
+
+bool MicroVulkanCompilerPermutations::Load( const std::string& path ) {
+	auto file = MicroVulkanMappedFile{ };
+
+	Destroy( );
+
+	if ( !file.Open( path ) )
+		return false;
+
+	auto* header_data = file.GetData( 0, sizeof( MicroVulkanCompilerCacheHeader ) );
+
+	if ( header_data == nullptr )
+		return false;
+
+	auto& header = micro_ref_as( header_data, const MicroVulkanCompilerCacheHeader );
+
+	if ( header.Magic != INDEX_MAGIC || header.Version != INDEX_VERSION )
+		return false;
+
+	auto* payload = file.GetData( sizeof( MicroVulkanCompilerCacheHeader ), header.Length );
+
+	if ( payload == nullptr || m_checksum.CRC32( payload, header.Length ) != header.CRC )
+		return false;
+
+	auto blob		   = MicroVulkanBlob{ payload, header.Length };
+	auto variants	   = std::vector<MicroVulkanCompilerVariant>{ };
+	auto keyword_count = (uint32_t)0;
+	auto binary_count  = (uint32_t)0;
+	auto success	   = blob.Read( keyword_count ) && keyword_count <= KEYWORD_LIMIT;
+
+	while ( success && keyword_count-- > 0 )
+		success = blob.Read( m_keywords.emplace_back( ) );
+
+	success = success && blob.Read( variants ) && blob.Read( binary_count );
+
+	while ( success && binary_count-- > 0 )
+		success = blob.Read( m_binaries.emplace_back( ) );
+
+	success = success && header.Hash == CreateKeywordHash( );
+
+	for ( const auto& variant : variants )
+		success = success && variant.Binary < m_binaries.size( ) && m_variants.emplace( variant.Mask, variant.Binary ).second;
+
+	if ( !success )
+		Destroy( );
+
+	return success;
+}
+
+bool MicroVulkanCompilerPermutations::Save( const std::string& path ) const {
+	if ( !GetIsValid( ) )
+		return false;
+
+	auto temp_path = std::format( "{}.tmp", path );
+	auto header	   = MicroVulkanCompilerCacheHeader{ };
+	auto variants  = std::vector<MicroVulkanCompilerVariant>{ };
+	auto* file	   = micro_cast( NULL, FILE* );
+	auto success   = false;
+	auto blob	   = MicroVulkanBlob{ };
+
+	variants.reserve( m_variants.size( ) );
+
+	for ( const auto& [ mask, binary ] : m_variants ) {
+		auto& variant = variants.emplace_back( );
+
+		variant.Mask	 = mask;
+		variant.Binary	 = binary;
+		variant.Reserved = 0;
+	}
+
+	// Variants are sorted so the same permutations always produce the same
+	// file, whatever the hash map iteration order is.
+	std::sort(
+		variants.begin( ), variants.end( ),
+		[]( const auto& left, const auto& right ) { return left.Mask < right.Mask; }
+	);
+
+	blob.Write( (uint32_t)m_keywords.size( ) );
+
+	for ( const auto& keyword : m_keywords )
+		blob.Write( keyword );
+
+	blob.Write( variants );
+	blob.Write( (uint32_t)m_binaries.size( ) );
+
+	for ( const auto& binary : m_binaries )
+		blob.Write( binary );
+
+	auto& payload = blob.Get( );
+
+	header.Magic   = INDEX_MAGIC;
+	header.Version = INDEX_VERSION;
+	header.Hash	   = CreateKeywordHash( );
+	header.Length  = (uint64_t)payload.size( );
+	header.CRC	   = m_checksum.CRC32( payload.data( ), payload.size( ) );
+
+#	ifdef _WIN32
+	if ( fopen_s( micro_ptr( file ), temp_path.c_str( ), "wb" ) != 0 )
+		file = NULL;
+#	else
+	file = fopen( temp_path.c_str( ), "wb" );
+#	endif
+
+	if ( file == NULL )
+		return false;
+
+	success = fwrite( micro_ptr( header ), sizeof( MicroVulkanCompilerCacheHeader ), 1, file ) == 1 &&
+			  fwrite( payload.data( ), sizeof( uint8_t ), payload.size( ), file ) == payload.size( );
+
+	fclose( file );
+
+	if ( success ) {
+		auto error = std::error_code{ };
+
+		std::filesystem::rename( temp_path, path, error );
+
+		success = !error;
+	}
+
+	if ( !success )
+		std::filesystem::remove( temp_path );
+
+	return success;
+}
+
+void MicroVulkanCompilerPermutations::Destroy( ) {
+	m_keywords.clear( );
+	m_variants.clear( );
+	m_binaries.clear( );
+	m_error.clear( );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool MicroVulkanCompilerPermutations::CreateMask(
+	const std::vector<std::string>& keywords,
+	uint64_t& mask
+) const {
+	mask = 0;
+
+	for ( const auto& keyword : keywords ) {
+		auto bit = GetMask( keyword );
+
+		if ( bit == 0 )
+			return false;
+
+		mask |= bit;
+	}
+
+	return true;
+}
+
+bool MicroVulkanCompilerPermutations::CreateRules(
+	const MicroVulkanCompilerPermutationSpecification& specification,
+	std::vector<MicroVulkanCompilerRuleMask>& rules
+) {
+	if ( specification.Keywords.size( ) > KEYWORD_LIMIT ) {
+		m_error = std::format( "Too many keywords, {} declared for a limit of {}.", specification.Keywords.size( ), KEYWORD_LIMIT );
+
+		return false;
+	}
+
+	m_keywords = specification.Keywords;
+
+	for ( const auto& rule : specification.Rules ) {
+		auto& rule_mask = rules.emplace_back( );
+
+		rule_mask.Type = rule.Type;
+
+		if (
+			!CreateMask( rule.Keywords, rule_mask.Keywords ) ||
+			!CreateMask( rule.Targets, rule_mask.Targets )
+		) {
+			m_error = "Permutation rule references an undeclared keyword.";
+
+			return false;
+		}
+	}
+
+	return true;
+}
+
+std::vector<uint64_t> MicroVulkanCompilerPermutations::CreateMasks(
+	const std::vector<MicroVulkanCompilerRuleMask>& rules
+) const {
+	auto masks = std::vector<uint64_t>{ };
+	auto count = (uint64_t)1 << m_keywords.size( );
+
+	for ( auto mask = (uint64_t)0; mask < count; mask++ ) {
+		if ( GetIsAllowed( rules, mask ) )
+			masks.emplace_back( mask );
+	}
+
+	return masks;
+}
+
+MicroVulkanCompilerJob MicroVulkanCompilerPermutations::CreateJob(
+	const MicroVulkanCompilerJob& job,
+	const uint64_t mask
+) const {
+	auto variant = job;
+
+	for ( auto keyword_id = (size_t)0; keyword_id < m_keywords.size( ); keyword_id++ ) {
+		if ( ( mask & ( (uint64_t)1 << keyword_id ) ) == 0 )
+			continue;
+
+		auto& macro = variant.Specification.Macros.emplace_back( );
+
+		macro.Name	= m_keywords[ keyword_id ].c_str( );
+		macro.Value = "1";
+	}
+
+	return variant;
+}
+
+uint32_t MicroVulkanCompilerPermutations::CreateBinary(
+	std::unordered_map<uint64_t, std::vector<uint32_t>>& binaries,
+	const std::vector<uint8_t>& output
+) {
+	auto hash = MicroVulkanHash{ };
+
+	hash.Combine( output );
+
+	// Keywords that don't touch the code path compile to the same SPIR-V,
+	// those variants point to the first binary instead of a copy.
+	auto& candidates = binaries[ hash ];
+
+	for ( const auto binary_id : candidates ) {
+		if ( m_binaries[ binary_id ] == output )
+			return binary_id;
+	}
+
+	auto binary_id = (uint32_t)m_binaries.size( );
+
+	m_binaries.emplace_back( output );
+	candidates.emplace_back( binary_id );
+
+	return binary_id;
+}
+
+uint64_t MicroVulkanCompilerPermutations::CreateKeywordHash( ) const {
+	auto hash = MicroVulkanHash{ };
+
+	for ( const auto& keyword : m_keywords )
+		hash.Combine( keyword );
+
+	return hash;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool MicroVulkanCompilerPermutations::GetIsValid( ) const {
+	return m_binaries.size( ) > 0;
+}
+
+uint64_t MicroVulkanCompilerPermutations::GetMask( const std::string& keyword ) const {
+	auto iterator = std::find( m_keywords.begin( ), m_keywords.end( ), keyword );
+
+	if ( iterator == m_keywords.end( ) )
+		return 0;
+
+	return (uint64_t)1 << ( iterator - m_keywords.begin( ) );
+}
+
+uint64_t MicroVulkanCompilerPermutations::GetMask( std::initializer_list<std::string> keywords ) const {
+	auto mask = (uint64_t)0;
+
+	for ( const auto& keyword : keywords )
+		mask |= GetMask( keyword );
+
+	return mask;
+}
+
+const std::vector<uint8_t>* MicroVulkanCompilerPermutations::GetBinary( const uint64_t mask ) const {
+	auto variant = m_variants.find( mask );
+
+	if ( variant == m_variants.end( ) )
+		return nullptr;
+
+	return micro_ptr( m_binaries[ variant->second ] );
+}
+
+const std::vector<std::string>& MicroVulkanCompilerPermutations::GetKeywords( ) const {
+	return m_keywords;
+}
+
+uint32_t MicroVulkanCompilerPermutations::GetVariantCount( ) const {
+	return (uint32_t)m_variants.size( );
+}
+
+uint32_t MicroVulkanCompilerPermutations::GetBinaryCount( ) const {
+	return (uint32_t)m_binaries.size( );
+}
+
+const std::string& MicroVulkanCompilerPermutations::GetError( ) const {
+	return m_error;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool MicroVulkanCompilerPermutations::GetIsAllowed(
+	const std::vector<MicroVulkanCompilerRuleMask>& rules,
+	const uint64_t mask
+) {
+	for ( const auto& rule : rules ) {
+		auto keywords = mask & rule.Keywords;
+		auto targets  = mask & rule.Targets;
+
+		// Exclusive allows at most one of its keywords, Requires and Excludes
+		// only apply once any of their keywords is enabled.
+		if ( rule.Type == MicroVulkanCompilerRuleType::Exclusive && ( keywords & ( keywords - 1 ) ) != 0 )
+			return false;
+
+		if ( rule.Type == MicroVulkanCompilerRuleType::Requires && keywords != 0 && targets != rule.Targets )
+			return false;
+
+		if ( rule.Type == MicroVulkanCompilerRuleType::Excludes && keywords != 0 && targets != 0 )
+			return false;
+	}
+
+	return true;
+}
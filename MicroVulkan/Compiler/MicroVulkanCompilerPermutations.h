@@ -0,0 +1,172 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "MicroVulkanShaderWatcher.h"
+
+micro_enum_class MicroVulkanCompilerRuleType : uint32_t {
+
+	Exclusive = 0,
+	Requires,
+	Excludes
+
+};
+
+micro_struct MicroVulkanCompilerRule {
+
+	MicroVulkanCompilerRuleType Type;
+	std::vector<std::string> Keywords;
+	std::vector<std::string> Targets;
+
+};
+
+micro_struct MicroVulkanCompilerRuleMask {
+
+	MicroVulkanCompilerRuleType Type;
+	uint64_t Keywords;
+	uint64_t Targets;
+
+};
+
+micro_struct MicroVulkanCompilerPermutationSpecification {
+
+	MicroVulkanCompilerJob Job;
+	std::vector<std::string> Keywords;
+	std::vector<MicroVulkanCompilerRule> Rules;
+
+};
+
+micro_struct MicroVulkanCompilerVariant {
+
+	uint64_t Mask;
+	uint32_t Binary;
+	uint32_t Reserved;
+
+};
+
+micro_class MicroVulkanCompilerPermutations final {
+
+	constexpr static uint32_t INDEX_MAGIC	= 0x5053564D;
+	constexpr static uint32_t INDEX_VERSION = 1;
+	constexpr static uint32_t KEYWORD_LIMIT = 20;
+
+private:
+	MicroVulkanChecksum m_checksum;
+	std::vector<std::string> m_keywords;
+	std::unordered_map<uint64_t, uint32_t> m_variants;
+	std::vector<std::vector<uint8_t>> m_binaries;
+	std::string m_error;
+
+public:
+	MicroVulkanCompilerPermutations( );
+
+	MicroVulkanCompilerPermutations( const MicroVulkanCompilerPermutations& ) = delete;
+
+	~MicroVulkanCompilerPermutations( ) = default;
+
+	/**
+	 * Create function
+	 * @note : Enumerate every keyword combination allowed by the rules and
+	 *		   compile them in parallel, each enabled keyword is defined to 1.
+	 *		   Variants producing the same SPIR-V share one binary.
+	 * @param workers : Query worker pool used for compilation.
+	 * @param compiler : Query compiler instance.
+	 * @param specification : Query permutation specification.
+	 * @return bool
+	 **/
+	bool Create(
+		MicroVulkanWorkerPool& workers,
+		MicroVulkanCompiler& compiler,
+		const MicroVulkanCompilerPermutationSpecification& specification
+	);
+
+	bool Load( const std::string& path );
+
+	bool Save( const std::string& path ) const;
+
+	void Destroy( );
+
+private:
+	bool CreateMask(
+		const std::vector<std::string>& keywords,
+		uint64_t& mask
+	) const;
+
+	bool CreateRules(
+		const MicroVulkanCompilerPermutationSpecification& specification,
+		std::vector<MicroVulkanCompilerRuleMask>& rules
+	);
+
+	std::vector<uint64_t> CreateMasks( const std::vector<MicroVulkanCompilerRuleMask>& rules ) const;
+
+	MicroVulkanCompilerJob CreateJob(
+		const MicroVulkanCompilerJob& job,
+		const uint64_t mask
+	) const;
+
+	uint32_t CreateBinary(
+		std::unordered_map<uint64_t, std::vector<uint32_t>>& binaries,
+		const std::vector<uint8_t>& output
+	);
+
+	uint64_t CreateKeywordHash( ) const;
+
+public:
+	bool GetIsValid( ) const;
+
+	uint64_t GetMask( const std::string& keyword ) const;
+
+	uint64_t GetMask( std::initializer_list<std::string> keywords ) const;
+
+	/**
+	 * GetBinary function
+	 * @note : Constant time lookup of the SPIR-V of a variant.
+	 * @param mask : Query keyword mask of the variant.
+	 * @return const std::vector<uint8_t>*
+	 **/
+	const std::vector<uint8_t>* GetBinary( const uint64_t mask ) const;
+
+	const std::vector<std::string>& GetKeywords( ) const;
+
+	uint32_t GetVariantCount( ) const;
+
+	uint32_t GetBinaryCount( ) const;
+
+	const std::string& GetError( ) const;
+
+private:
+	static bool GetIsAllowed(
+		const std::vector<MicroVulkanCompilerRuleMask>& rules,
+		const uint64_t mask
+	);
+
+};
@@ -0,0 +1,162 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "__micro_vulkan_pch.h"
+
+#ifdef __linux__
+#	include <sys/inotify.h>
+#	include <unistd.h>
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+MicroVulkanShaderWatcher::MicroVulkanShaderWatcher( )
+	: m_handle{ -1 },
+	m_directories{ }
+{ }
+
+MicroVulkanShaderWatcher::~MicroVulkanShaderWatcher( ) {
+	Destroy( );
+}
+
+bool MicroVulkanShaderWatcher::Create( const std::vector<std::string>& directories ) {
+	Destroy( );
+
+#	ifdef __linux__
+	m_handle = inotify_init1( IN_NONBLOCK | IN_CLOEXEC );
+
+	if ( m_handle == -1 )
+		return false;
+
+	for ( const auto& directory : directories ) {
+		if ( !CreateWatch( directory ) )
+			return false;
+	}
+#	endif
+
+	return GetIsValid( );
+}
+
+std::vector<std::string> MicroVulkanShaderWatcher::Poll( ) {
+	auto changes = std::set<std::string>{ };
+
+#	ifdef __linux__
+	if ( !GetIsValid( ) )
+		return { };
+
+	alignas( inotify_event ) char buffer[ EVENT_BUFFER_SIZE ];
+
+	auto length = read( m_handle, buffer, sizeof( buffer ) );
+
+	while ( length > 0 ) {
+		auto offset = (ssize_t)0;
+
+		while ( offset < length ) {
+			auto& event		= micro_ref_as( buffer + offset, const inotify_event );
+			auto directory	= m_directories.find( event.wd );
+
+			offset += sizeof( inotify_event ) + event.len;
+
+			if ( directory == m_directories.end( ) )
+				continue;
+
+			if ( event.mask & IN_IGNORED ) {
+				m_directories.erase( directory );
+
+				continue;
+			}
+
+			if ( event.len == 0 )
+				continue;
+
+			auto path = std::format( "{}/{}", directory->second, event.name );
+
+			// Editors often save through a rename, a moved-in file counts as
+			// written. New directories are watched as they appear.
+			if ( event.mask & IN_ISDIR ) {
+				if ( event.mask & ( IN_CREATE | IN_MOVED_TO ) )
+					CreateWatch( path );
+			} else if ( event.mask & ( IN_CLOSE_WRITE | IN_MOVED_TO ) )
+				changes.emplace( MicroVulkanCompilerIncluder::CreatePath( path ) );
+		}
+
+		length = read( m_handle, buffer, sizeof( buffer ) );
+	}
+#	endif
+
+	return { changes.begin( ), changes.end( ) };
+}
+
+void MicroVulkanShaderWatcher::Destroy( ) {
+#	ifdef __linux__
+	if ( m_handle != -1 )
+		close( m_handle );
+#	endif
+
+	m_handle = -1;
+
+	m_directories.clear( );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool MicroVulkanShaderWatcher::CreateWatch( const std::string& directory ) {
+#	ifdef __linux__
+	auto path	= MicroVulkanCompilerIncluder::CreatePath( directory );
+	auto error	= std::error_code{ };
+	auto mask	= IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE;
+	auto handle = inotify_add_watch( m_handle, path.c_str( ), mask | IN_ONLYDIR );
+
+	if ( handle == -1 )
+		return false;
+
+	m_directories[ handle ] = path;
+
+	// inotify isn't recursive, every sub directory gets its own watch.
+	for ( const auto& entry : std::filesystem::directory_iterator{ path, error } ) {
+		if ( entry.is_directory( error ) )
+			CreateWatch( entry.path( ).string( ) );
+	}
+
+	return true;
+#	else
+	return false;
+#	endif
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool MicroVulkanShaderWatcher::GetIsValid( ) const {
+	return m_handle != -1;
+}
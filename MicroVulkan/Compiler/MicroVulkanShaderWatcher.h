@@ -0,0 +1,69 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "MicroVulkanCompiler.h"
+
+micro_class MicroVulkanShaderWatcher final {
+
+	constexpr static uint32_t EVENT_BUFFER_SIZE = 16384;
+
+private:
+	int32_t m_handle;
+	std::unordered_map<int32_t, std::string> m_directories;
+
+public:
+	MicroVulkanShaderWatcher( );
+
+	MicroVulkanShaderWatcher( const MicroVulkanShaderWatcher& ) = delete;
+
+	~MicroVulkanShaderWatcher( );
+
+	bool Create( const std::vector<std::string>& directories );
+
+	/**
+	 * Poll function
+	 * @note : Drain pending file events without blocking, only files that
+	 *		   were fully written or moved in are reported, once each.
+	 * @return std::vector<std::string>
+	 **/
+	std::vector<std::string> Poll( );
+
+	void Destroy( );
+
+private:
+	bool CreateWatch( const std::string& directory );
+
+public:
+	bool GetIsValid( ) const;
+
+};
@@ -38,15 +38,30 @@ MicroVulkanDevice::MicroVulkanDevice( )
 	: m_specification{ },
     m_physical{ VK_NULL_HANDLE },
 	m_device{ VK_NULL_HANDLE },
-    m_memory{ }
+    m_memory{ },
+    m_extensions{ },
+    m_cache_control{ },
+    m_module_identifier{ },
+    m_descriptor_indexing{ },
+    m_descriptor_limits{ },
+    m_dynamic_state{ },
+    m_dynamic_state3{ },
+    m_pipeline_library{ },
+    m_shader_object{ },
+    m_dynamic_rendering{ },
+    m_features{ VK_NULL_HANDLE }
 { }
 
 bool MicroVulkanDevice::Create(
     const MicroVulkanInstance& instance,
     const MicroVulkanSpecification& specification
 ) {
-	return  CreatePhysical( specification, instance ) &&
-            CreateDevice( specification );
+	if ( !CreatePhysical( specification, instance ) )
+        return false;
+
+    CreateFeatures( specification );
+
+    return CreateDevice( specification );
 }
 
 VkMemoryAllocateInfo MicroVulkanDevice::CreateImageAllocationSpec(
@@ -61,7 +76,7 @@ VkMemoryAllocateInfo MicroVulkanDevice::CreateImageAllocationSpec(
     allocation_spec.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
     allocation_spec.pNext           = VK_NULL_HANDLE;
     allocation_spec.allocationSize  = requirements.size;
-    allocation_spec.memoryTypeIndex = GetPeekMemoryType( VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, requirements.memoryTypeBits );
+    allocation_spec.memoryTypeIndex = GetPeekMemoryType( properties, requirements.memoryTypeBits );
 
     return allocation_spec;
 }
@@ -78,7 +93,7 @@ VkMemoryAllocateInfo MicroVulkanDevice::CreateBufferAllocationSpec(
     allocation_spec.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
     allocation_spec.pNext           = VK_NULL_HANDLE;
     allocation_spec.allocationSize  = requirements.size;
-    allocation_spec.memoryTypeIndex = GetPeekMemoryType( VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, requirements.memoryTypeBits );
+    allocation_spec.memoryTypeIndex = GetPeekMemoryType( properties, requirements.memoryTypeBits );
 
     return allocation_spec;
 }
@@ -122,7 +137,7 @@ uint32_t MicroVulkanDevice::CreatePhysicalScore(
 
     vk::GetPhysicalSpecification( physical, surface, physical_spec );
 
-    if ( 
+    if (
         GetPhysicalHasExtensions( specification, physical )    &&
         GetPhysicalHasFeatures( specification, physical_spec ) &&
         GetPhysicalHasDepth( specification, physical )
@@ -177,6 +192,142 @@ bool MicroVulkanDevice::CreatePhysical(
     return vk::IsValid( m_physical );
 }
 
+void MicroVulkanDevice::CreateFeatures( const MicroVulkanSpecification& specification ) {
+    auto api_version = std::min( specification.Application.apiVersion, m_specification.Properties.apiVersion );
+    auto extensions  = std::vector<VkExtensionProperties>{ };
+    auto features    = VkPhysicalDeviceFeatures2{ };
+    auto queried     = std::vector<VkBaseOutStructure*>{ };
+    auto enabled     = std::vector<VkBaseOutStructure*>{ };
+
+    m_extensions = specification.DeviceExtensions;
+
+    if ( api_version < VK_API_VERSION_1_1 )
+        return;
+
+    vk::EnumeratePhysicalExtension( m_physical, extensions );
+
+    m_cache_control.sType       = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_CREATION_CACHE_CONTROL_FEATURES_EXT;
+    m_module_identifier.sType   = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_MODULE_IDENTIFIER_FEATURES_EXT;
+    m_descriptor_indexing.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
+    m_dynamic_state.sType       = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT;
+    m_dynamic_state3.sType      = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_FEATURES_EXT;
+    m_pipeline_library.sType    = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT;
+    m_shader_object.sType       = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_OBJECT_FEATURES_EXT;
+    m_dynamic_rendering.sType   = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES;
+
+    // Optional features are only chained when the physical device exposes
+    // their extension, the query would be invalid otherwise.
+    if (
+        GetPhysicalHasExtension( extensions, VK_EXT_PIPELINE_CREATION_CACHE_CONTROL_EXTENSION_NAME ) &&
+        GetPhysicalHasExtension( extensions, VK_EXT_SHADER_MODULE_IDENTIFIER_EXTENSION_NAME )
+    ) {
+        queried.emplace_back( micro_ptr_as( m_module_identifier, VkBaseOutStructure* ) );
+        queried.emplace_back( micro_ptr_as( m_cache_control, VkBaseOutStructure* ) );
+    }
+
+    if ( api_version >= VK_API_VERSION_1_2 || GetPhysicalHasExtension( extensions, VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME ) )
+        queried.emplace_back( micro_ptr_as( m_descriptor_indexing, VkBaseOutStructure* ) );
+
+    if ( GetPhysicalHasExtension( extensions, VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME ) )
+        queried.emplace_back( micro_ptr_as( m_dynamic_state, VkBaseOutStructure* ) );
+
+    if ( GetPhysicalHasExtension( extensions, VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME ) )
+        queried.emplace_back( micro_ptr_as( m_dynamic_state3, VkBaseOutStructure* ) );
+
+    if (
+        GetPhysicalHasExtension( extensions, VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME ) &&
+        GetPhysicalHasExtension( extensions, VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME )
+    )
+        queried.emplace_back( micro_ptr_as( m_pipeline_library, VkBaseOutStructure* ) );
+
+    // Shader objects depend on dynamic rendering, core since 1.3 and only
+    // available as an extension from 1.2.
+    if (
+        specification.ShaderObject                                                 &&
+        api_version >= VK_API_VERSION_1_2                                          &&
+        GetPhysicalHasExtension( extensions, VK_EXT_SHADER_OBJECT_EXTENSION_NAME ) &&
+        ( api_version >= VK_API_VERSION_1_3 || GetPhysicalHasExtension( extensions, VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME ) )
+    ) {
+        queried.emplace_back( micro_ptr_as( m_shader_object, VkBaseOutStructure* ) );
+        queried.emplace_back( micro_ptr_as( m_dynamic_rendering, VkBaseOutStructure* ) );
+    }
+
+    features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+    features.pNext = CreateFeatureChain( queried );
+
+    vkGetPhysicalDeviceFeatures2( m_physical, micro_ptr( features ) );
+
+    // Structures left out of the query stay zeroed, the getters report
+    // them as unsupported and they are never enabled.
+    if ( GetHasShaderModuleIdentifier( ) ) {
+        enabled.emplace_back( micro_ptr_as( m_module_identifier, VkBaseOutStructure* ) );
+        enabled.emplace_back( micro_ptr_as( m_cache_control, VkBaseOutStructure* ) );
+
+        m_extensions.emplace_back( VK_EXT_PIPELINE_CREATION_CACHE_CONTROL_EXTENSION_NAME );
+        m_extensions.emplace_back( VK_EXT_SHADER_MODULE_IDENTIFIER_EXTENSION_NAME );
+    }
+
+    if ( GetHasDescriptorIndexing( ) ) {
+        auto properties = VkPhysicalDeviceProperties2{ };
+
+        // Update after bind sets have their own, usually lower, limits.
+        m_descriptor_limits.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES;
+        properties.sType          = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+        properties.pNext          = micro_ptr( m_descriptor_limits );
+
+        vkGetPhysicalDeviceProperties2( m_physical, micro_ptr( properties ) );
+
+        enabled.emplace_back( micro_ptr_as( m_descriptor_indexing, VkBaseOutStructure* ) );
+
+        if ( api_version < VK_API_VERSION_1_2 )
+            m_extensions.emplace_back( VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME );
+    }
+
+    if ( GetHasExtendedDynamicState( ) ) {
+        enabled.emplace_back( micro_ptr_as( m_dynamic_state, VkBaseOutStructure* ) );
+
+        m_extensions.emplace_back( VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME );
+    }
+
+    if ( GetHasExtendedDynamicState3( ) ) {
+        enabled.emplace_back( micro_ptr_as( m_dynamic_state3, VkBaseOutStructure* ) );
+
+        m_extensions.emplace_back( VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME );
+    }
+
+    if ( GetHasGraphicsPipelineLibrary( ) ) {
+        enabled.emplace_back( micro_ptr_as( m_pipeline_library, VkBaseOutStructure* ) );
+
+        m_extensions.emplace_back( VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME );
+        m_extensions.emplace_back( VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME );
+    }
+
+    if ( GetHasShaderObject( ) ) {
+        enabled.emplace_back( micro_ptr_as( m_shader_object, VkBaseOutStructure* ) );
+        enabled.emplace_back( micro_ptr_as( m_dynamic_rendering, VkBaseOutStructure* ) );
+
+        m_extensions.emplace_back( VK_EXT_SHADER_OBJECT_EXTENSION_NAME );
+
+        if ( api_version < VK_API_VERSION_1_3 )
+            m_extensions.emplace_back( VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME );
+    }
+
+    m_features = CreateFeatureChain( enabled );
+}
+
+void* MicroVulkanDevice::CreateFeatureChain( const std::vector<VkBaseOutStructure*>& features ) {
+    auto* chain     = micro_cast( VK_NULL_HANDLE, VkBaseOutStructure* );
+    auto feature_id = features.size( );
+
+    while ( feature_id-- > 0 ) {
+        features[ feature_id ]->pNext = chain;
+
+        chain = features[ feature_id ];
+    }
+
+    return chain;
+}
+
 std::vector<VkDeviceQueueCreateInfo> MicroVulkanDevice::CreatePhysicalQueues( 
     const std::vector<float>& priorities 
 ) {
@@ -206,17 +357,26 @@ bool MicroVulkanDevice::CreateDevice( const MicroVulkanSpecification& specificat
     auto queues           = CreatePhysicalQueues( queue_priorities );
 
     create_info.sType                   = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
-    create_info.pNext                   = VK_NULL_HANDLE;
+    create_info.pNext                   = m_features;
     create_info.flags                   = VK_UNUSED_FLAG;
     create_info.queueCreateInfoCount    = (uint32_t)queues.size( );
     create_info.pQueueCreateInfos       = queues.data( );
     create_info.enabledLayerCount       = (uint32_t)specification.Validations.size( );
     create_info.ppEnabledLayerNames     = specification.Validations.data( );
-    create_info.enabledExtensionCount   = (uint32_t)specification.DeviceExtensions.size( );
-    create_info.ppEnabledExtensionNames = specification.DeviceExtensions.data( );
+    create_info.enabledExtensionCount   = (uint32_t)m_extensions.size( );
+    create_info.ppEnabledExtensionNames = m_extensions.data( );
     create_info.pEnabledFeatures        = VK_NULL_HANDLE;
 
-	return vk::CreateDevice( m_physical, create_info, m_device ) == VK_SUCCESS;
+	if ( vk::CreateDevice( m_physical, create_info, m_device ) != VK_SUCCESS )
+        return false;
+
+    if ( GetHasExtendedDynamicState( ) || GetHasExtendedDynamicState3( ) || GetHasShaderObject( ) )
+        vk::LoadDynamicState( m_device );
+
+    if ( GetHasShaderObject( ) )
+        vk::LoadShaderObject( m_device );
+
+    return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////
@@ -234,6 +394,14 @@ VkDevice MicroVulkanDevice::GetDevice( ) const {
 	return m_device;
 }
 
+VkFormatProperties MicroVulkanDevice::GetFormatProperties( const VkFormat format ) const {
+    auto properties = VkFormatProperties{ };
+
+    vkGetPhysicalDeviceFormatProperties( m_physical, format, micro_ptr( properties ) );
+
+    return properties;
+}
+
 uint32_t MicroVulkanDevice::GetPeekMemoryType(
     VkMemoryPropertyFlags properties,
     uint32_t requirement_bits
@@ -241,7 +409,7 @@ uint32_t MicroVulkanDevice::GetPeekMemoryType(
     auto memory_type_id = (uint32_t)0;
 
     while ( memory_type_id < m_memory.memoryTypeCount ) {
-        if ( 
+        if (
             ( requirement_bits & 1 ) && 
             ( m_memory.memoryTypes[ memory_type_id ].propertyFlags & properties ) == properties 
         )
@@ -257,6 +425,51 @@ uint32_t MicroVulkanDevice::GetPeekMemoryType(
     return memory_type_id;
 }
 
+bool MicroVulkanDevice::GetHasExtension( micro_string extension ) const {
+    for ( auto& current : m_extensions ) {
+        if ( strcmp( current, extension ) == 0 )
+            return true;
+    }
+
+    return false;
+}
+
+bool MicroVulkanDevice::GetHasShaderModuleIdentifier( ) const {
+    return  m_module_identifier.shaderModuleIdentifier == VK_TRUE &&
+            m_cache_control.pipelineCreationCacheControl == VK_TRUE;
+}
+
+bool MicroVulkanDevice::GetHasDescriptorIndexing( ) const {
+    return  m_descriptor_indexing.runtimeDescriptorArray == VK_TRUE                        &&
+            m_descriptor_indexing.descriptorBindingPartiallyBound == VK_TRUE               &&
+            m_descriptor_indexing.descriptorBindingSampledImageUpdateAfterBind == VK_TRUE  &&
+            m_descriptor_indexing.descriptorBindingStorageBufferUpdateAfterBind == VK_TRUE;
+}
+
+const VkPhysicalDeviceDescriptorIndexingProperties& MicroVulkanDevice::GetDescriptorIndexingLimits( ) const {
+    return m_descriptor_limits;
+}
+
+bool MicroVulkanDevice::GetHasExtendedDynamicState( ) const {
+    return m_dynamic_state.extendedDynamicState == VK_TRUE;
+}
+
+bool MicroVulkanDevice::GetHasExtendedDynamicState3( ) const {
+    return  m_dynamic_state3.extendedDynamicState3PolygonMode == VK_TRUE        &&
+            m_dynamic_state3.extendedDynamicState3ColorBlendEnable == VK_TRUE   &&
+            m_dynamic_state3.extendedDynamicState3ColorBlendEquation == VK_TRUE &&
+            m_dynamic_state3.extendedDynamicState3ColorWriteMask == VK_TRUE;
+}
+
+bool MicroVulkanDevice::GetHasGraphicsPipelineLibrary( ) const {
+    return m_pipeline_library.graphicsPipelineLibrary == VK_TRUE;
+}
+
+bool MicroVulkanDevice::GetHasShaderObject( ) const {
+    return  m_shader_object.shaderObject == VK_TRUE &&
+            m_dynamic_rendering.dynamicRendering == VK_TRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////
 //		===	PRIVATE GET ===
 ////////////////////////////////////////////////////////////////////////////////////////////
@@ -327,6 +540,18 @@ uint32_t MicroVulkanDevice::GetPhysicalQueueScore(
     return score;
 }
 
+bool MicroVulkanDevice::GetPhysicalHasExtension(
+    const std::vector<VkExtensionProperties>& extensions,
+    micro_string extension
+) const {
+    for ( auto& current : extensions ) {
+        if ( strcmp( current.extensionName, extension ) == 0 )
+            return true;
+    }
+
+    return false;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////
 //		===	OPERATOR ===
 ////////////////////////////////////////////////////////////////////////////////////////////
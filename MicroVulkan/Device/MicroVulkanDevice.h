@@ -40,6 +40,17 @@ private:
 	VkPhysicalDevice m_physical;
 	VkDevice m_device;
 	VkPhysicalDeviceMemoryProperties m_memory;
+	std::vector<micro_string> m_extensions;
+	VkPhysicalDevicePipelineCreationCacheControlFeaturesEXT m_cache_control;
+	VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT m_module_identifier;
+	VkPhysicalDeviceDescriptorIndexingFeatures m_descriptor_indexing;
+	VkPhysicalDeviceDescriptorIndexingProperties m_descriptor_limits;
+	VkPhysicalDeviceExtendedDynamicStateFeaturesEXT m_dynamic_state;
+	VkPhysicalDeviceExtendedDynamicState3FeaturesEXT m_dynamic_state3;
+	VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT m_pipeline_library;
+	VkPhysicalDeviceShaderObjectFeaturesEXT m_shader_object;
+	VkPhysicalDeviceDynamicRenderingFeatures m_dynamic_rendering;
+	void* m_features;
 
 public:
 	MicroVulkanDevice( );
@@ -88,6 +99,10 @@ private:
 		const MicroVulkanInstance& instance 
 	);
 
+	void CreateFeatures( const MicroVulkanSpecification& specification );
+
+	void* CreateFeatureChain( const std::vector<VkBaseOutStructure*>& features );
+
 	std::vector<VkDeviceQueueCreateInfo> CreatePhysicalQueues( const std::vector<float>& priorities );
 
 	bool CreateDevice( const MicroVulkanSpecification& specification );
@@ -99,11 +114,29 @@ public:
 
 	VkDevice GetDevice( ) const;
 
+	VkFormatProperties GetFormatProperties( const VkFormat format ) const;
+
 	uint32_t GetPeekMemoryType( 
 		const VkMemoryPropertyFlags properties,
 		uint32_t requirement_bits
 	) const;
 
+	bool GetHasExtension( micro_string extension ) const;
+
+	bool GetHasShaderModuleIdentifier( ) const;
+
+	bool GetHasDescriptorIndexing( ) const;
+
+	const VkPhysicalDeviceDescriptorIndexingProperties& GetDescriptorIndexingLimits( ) const;
+
+	bool GetHasExtendedDynamicState( ) const;
+
+	bool GetHasExtendedDynamicState3( ) const;
+
+	bool GetHasGraphicsPipelineLibrary( ) const;
+
+	bool GetHasShaderObject( ) const;
+
 private:
 	bool GetPhysicalHasExtensions(
 		const MicroVulkanSpecification& specification,
@@ -122,6 +155,11 @@ private:
 
 	uint32_t GetPhysicalQueueScore( const vk::DeviceSpecification& physical_spec );
 
+	bool GetPhysicalHasExtension(
+		const std::vector<VkExtensionProperties>& extensions,
+		micro_string extension
+	) const;
+
 public:
 	operator VkDevice ( ) const;
 
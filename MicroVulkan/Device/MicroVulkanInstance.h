@@ -31,7 +31,7 @@
 
 #pragma once
 
-#include "../Utils/MicroVulkanWindow.h"
+#include "../Utils/MicroVulkanBlob.h"
 
 micro_class MicroVulkanInstance final {
 
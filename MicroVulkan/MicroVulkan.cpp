@@ -44,9 +44,14 @@ MicroVulkan::MicroVulkan( )
 	m_passes{ },
 	m_synchronization{ },
 	m_stagings{ },
+	m_texture_cache{ },
 	m_commands{ },
 	m_framebuffers{ },
-	m_pipeline_cache{ }
+	m_pipeline_cache{ },
+	m_pipeline_registry{ },
+	m_shader_registry{ },
+	m_descriptors{ },
+	m_bindless{ }
 { }
 
 bool MicroVulkan::Create(
@@ -93,6 +98,9 @@ bool MicroVulkan::Acquire(
 
 		vk::WaitForFence( m_device, render_context.Sync->Signal, UINT64_MAX );
 		vk::ResetFence( m_device, render_context.Sync->Signal );
+
+		m_descriptors.Reset( m_device, render_context.FrameID );
+		m_bindless.Reset( );
 	}
 
 	return success;
@@ -187,11 +195,112 @@ void MicroVulkan::Present(
 	m_frame_id = ( m_frame_id + 1 ) % m_frame_count;
 }
 
+bool MicroVulkan::AcquireUpload( MicroVulkanUploadContext& upload_context ) {
+	upload_context.Queue		 = m_queues.AcquireUpload( );
+	upload_context.CommandBuffer = m_commands.AcquireUpload( );
+
+	auto state = CreateUploadSignal( upload_context ) && 
+				 upload_context.GetIsValid( )		  &&
+				 upload_context.CmdBeginRecord( ) == VK_SUCCESS;
+
+	if ( !state )
+		DestroyUploadContext( upload_context );
+
+	return state;
+}
+
+VkResult MicroVulkan::Stage(
+	MicroVulkanUploadContext& upload_context,
+	const uint32_t length,
+	const void* data,
+	VkBuffer& buffer,
+	uint32_t& offset
+) {
+	auto result = VK_ERROR_UNKNOWN;
+
+	if ( upload_context.GetIsValid( ) ) {
+		auto& stagings = upload_context.Stagings;
+
+		if ( stagings.empty( ) || !stagings.back( ).GetCanStore( length ) ) {
+			auto staging = m_stagings.Acquire( m_device, m_queues, length );
+
+			if ( staging.GetIsValid( ) )
+				stagings.emplace_back( staging );
+			else
+				return VK_ERROR_OUT_OF_HOST_MEMORY;
+		}
+
+		auto& staging = stagings.back( );
+
+		result = staging.Copy( length, data, offset );
+		buffer = staging.Handle->Buffer;
+	}
+
+	return result;
+}
+
+VkResult MicroVulkan::SubmitUpload( MicroVulkanUploadContext& upload_context ) {
+	auto result = DispatchUpload( upload_context );
+
+	// Staging buffers are recycled on release, they must outlive the copies.
+	if ( result == VK_SUCCESS )
+		result = ReleaseUpload( upload_context, UINT64_MAX );
+
+	return result;
+}
+
+VkResult MicroVulkan::DispatchUpload( MicroVulkanUploadContext& upload_context ) {
+	auto result = VK_ERROR_UNKNOWN;
+
+	if ( upload_context.GetIsValid( ) ) {
+		auto specification = VkSubmitInfo{ };
+
+		upload_context.CmdEndRecord( );
+
+		specification.sType				   = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+		specification.pNext				   = VK_NULL_HANDLE;
+		specification.waitSemaphoreCount   = 0;
+		specification.pWaitSemaphores	   = VK_NULL_HANDLE;
+		specification.pWaitDstStageMask    = VK_NULL_HANDLE;
+		specification.commandBufferCount   = 1;
+		specification.pCommandBuffers	   = micro_ptr( upload_context.CommandBuffer.Buffer );
+		specification.signalSemaphoreCount = 0;
+		specification.pSignalSemaphores	   = VK_NULL_HANDLE;
+
+		result = vk::QueueSubmit( upload_context.Queue, upload_context.Signal, specification );
+	}
+
+	if ( result != VK_SUCCESS )
+		DestroyUploadContext( upload_context );
+
+	return result;
+}
+
+VkResult MicroVulkan::ReleaseUpload( 
+	MicroVulkanUploadContext& upload_context,
+	const uint64_t timeout
+) {
+	if ( !vk::IsValid( upload_context.Signal ) )
+		return VK_ERROR_UNKNOWN;
+
+	auto result = vk::WaitForFence( m_device, upload_context.Signal, timeout );
+
+	if ( result != VK_TIMEOUT )
+		DestroyUploadContext( upload_context );
+
+	return result;
+}
+
 void MicroVulkan::Destroy( ) {
 	m_device.Wait( );
 
+	m_bindless.Destroy( m_device );
+	m_descriptors.Destroy( m_device );
+	m_pipeline_registry.Destroy( m_device );
+	m_shader_registry.Destroy( m_device );
 	m_pipeline_cache.Destroy( m_device );
-	m_framebuffers.Destroy( m_device );
+	m_framebuffers.Destroy( m_device, m_texture_cache );
+	m_texture_cache.Destroy( m_device );
 	m_commands.Destroy( m_device );
 	m_stagings.Destroy( m_device );
 	m_synchronization.Destroy( m_device );
@@ -256,9 +365,11 @@ bool MicroVulkan::CreatePipelines(
 	const MicroVulkanWindow& window,
 	const MicroVulkanSpecification& specification
 ) {
-	return  m_commands.Create( m_device, m_queues, m_swapchain )									  &&
-			m_framebuffers.Create( window, m_device, m_queues, m_swapchain, m_passes, specification ) &&
-			m_pipeline_cache.Create( m_device, specification );
+	return  m_commands.Create( m_device, m_queues, m_swapchain )													   &&
+			m_framebuffers.Create( window, m_device, m_queues, m_texture_cache, m_swapchain, m_passes, specification ) &&
+			m_pipeline_cache.Create( m_device, specification )														   &&
+			m_descriptors.Create( m_pipeline_cache, m_frame_count )													   &&
+			m_bindless.Create( m_device, m_pipeline_cache, m_frame_count );
 }
 
 VkResult MicroVulkan::CreateRenderContext(
@@ -289,11 +400,35 @@ VkPresentInfoKHR MicroVulkan::CreatePresentSpec(
 	return specification;
 }
 
+bool MicroVulkan::CreateUploadSignal( MicroVulkanUploadContext& upload_context ) {
+	auto specification = VkFenceCreateInfo{ };
+
+	specification.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+	specification.pNext = VK_NULL_HANDLE;
+	specification.flags = VK_UNUSED_FLAG;
+
+	return vk::CreateFence( m_device, specification, upload_context.Signal ) == VK_SUCCESS;
+}
+
 void MicroVulkan::DestroyRenderContext( MicroVulkanRenderContext& render_context ) {
 	m_commands.Release( render_context.CommandBuffer );
 	m_queues.Release( render_context.Queue );
 }
 
+void MicroVulkan::DestroyUploadContext( MicroVulkanUploadContext& upload_context ) {
+	for ( auto& staging : upload_context.Stagings )
+		m_stagings.Release( m_device, staging );
+
+	upload_context.Stagings.clear( );
+
+	// Upload queues are reserved, the context only drops its handle.
+	m_commands.ReleaseUpload( upload_context.CommandBuffer );
+
+	upload_context.Queue = { };
+
+	vk::DestroyFence( m_device, upload_context.Signal );
+}
+
 void MicroVulkan::Recreate( 
 	const MicroVulkanWindow& window,
 	MicroVulkanRenderContext& render_context
@@ -305,7 +440,7 @@ void MicroVulkan::Recreate(
 	m_device.Wait( );
 
 	m_swapchain.Recreate( m_instance, m_device, dimensions );
-	m_framebuffers.Recreate( m_device, m_queues, m_swapchain, m_passes, dimensions );
+	m_framebuffers.Recreate( m_device, m_queues, m_texture_cache, m_swapchain, m_passes, dimensions );
 
 	m_device.Wait( );
 }
@@ -353,6 +488,14 @@ MicroVulkanStagings& MicroVulkan::GetStaging( ) {
 	return m_stagings;
 }
 
+MicroVulkanTextureCache& MicroVulkan::GetTextureCache( ) {
+	return m_texture_cache;
+}
+
+const MicroVulkanTextureCache& MicroVulkan::GetTextureCache( ) const {
+	return m_texture_cache;
+}
+
 MicroVulkanCommands& MicroVulkan::GetCommands( ) {
 	return m_commands;
 }
@@ -392,10 +535,50 @@ const MicroVulkanFrameTarget& MicroVulkan::GetFramebufferTarget(
 	return m_framebuffers.GetTarget( render_pass_id, frame_id );
 }
 
+MicroVulkanPipelines& MicroVulkan::GetPipelines( ) {
+	return m_pipeline_cache;
+}
+
 const MicroVulkanPipelines& MicroVulkan::GetPipelines( ) const {
 	return m_pipeline_cache;
 }
 
+MicroVulkanPipelineRegistry& MicroVulkan::GetPipelineRegistry( ) {
+	return m_pipeline_registry;
+}
+
+const MicroVulkanPipelineRegistry& MicroVulkan::GetPipelineRegistry( ) const {
+	return m_pipeline_registry;
+}
+
+MicroVulkanShaderRegistry& MicroVulkan::GetShaderRegistry( ) {
+	return m_shader_registry;
+}
+
+const MicroVulkanShaderRegistry& MicroVulkan::GetShaderRegistry( ) const {
+	return m_shader_registry;
+}
+
+MicroVulkanDescriptorAllocator& MicroVulkan::GetDescriptorAllocator( ) {
+	return m_descriptors;
+}
+
+const MicroVulkanDescriptorAllocator& MicroVulkan::GetDescriptorAllocator( ) const {
+	return m_descriptors;
+}
+
+MicroVulkanBindless& MicroVulkan::GetBindless( ) {
+	return m_bindless;
+}
+
+const MicroVulkanBindless& MicroVulkan::GetBindless( ) const {
+	return m_bindless;
+}
+
+uint32_t MicroVulkan::GetFrameCount( ) const {
+	return m_frame_count;
+}
+
 const VkPipelineCache& MicroVulkan::GetPipelineCache( ) const {
 	return m_pipeline_cache.GetCache( );
 }
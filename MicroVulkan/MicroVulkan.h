@@ -31,7 +31,7 @@
 
 #pragma once
 
-#include "Rendering/MicroVulkanRenderContext.h"
+#include "Rendering/MicroVulkanUploadContext.h"
 
 micro_class MicroVulkan final { 
 
@@ -45,9 +45,14 @@ private:
 	MicroVulkanRenderPasses m_passes;
 	MicroVulkanSynchronization m_synchronization;
 	MicroVulkanStagings m_stagings;
+	MicroVulkanTextureCache m_texture_cache;
 	MicroVulkanCommands m_commands;
 	MicroVulkanFramebuffers m_framebuffers;
 	MicroVulkanPipelines m_pipeline_cache;
+	MicroVulkanPipelineRegistry m_pipeline_registry;
+	MicroVulkanShaderRegistry m_shader_registry;
+	MicroVulkanDescriptorAllocator m_descriptors;
+	MicroVulkanBindless m_bindless;
 
 public:
 	MicroVulkan( );
@@ -96,6 +101,40 @@ public:
 		bool& need_resize
 	);
 
+	bool AcquireUpload( MicroVulkanUploadContext& upload_context );
+
+	VkResult Stage(
+		MicroVulkanUploadContext& upload_context,
+		const uint32_t length,
+		const void* data,
+		VkBuffer& buffer,
+		uint32_t& offset
+	);
+
+	VkResult SubmitUpload( MicroVulkanUploadContext& upload_context );
+
+	/**
+	 * DispatchUpload function
+	 * @note : Submit without waiting, the context keeps its command buffer and
+	 *		   staging buffers until ReleaseUpload sees its fence signaled.
+	 * @param upload_context : Query upload context to submit.
+	 * @return VkResult
+	 **/
+	VkResult DispatchUpload( MicroVulkanUploadContext& upload_context );
+
+	/**
+	 * ReleaseUpload function
+	 * @note : Wait up to timeout nanoseconds for a dispatched upload, the
+	 *		   context is kept on VK_TIMEOUT and destroyed otherwise.
+	 * @param upload_context : Query dispatched upload context.
+	 * @param timeout : Query wait time, 0 only polls the fence.
+	 * @return VkResult
+	 **/
+	VkResult ReleaseUpload( 
+		MicroVulkanUploadContext& upload_context,
+		const uint64_t timeout
+	);
+
 	void Destroy( );
 
 private:
@@ -129,8 +168,12 @@ private:
 		const MicroVulkanRenderContext& render_context
 	);
 
+	bool CreateUploadSignal( MicroVulkanUploadContext& upload_context );
+
 	void DestroyRenderContext( MicroVulkanRenderContext& render_context );
 
+	void DestroyUploadContext( MicroVulkanUploadContext& upload_context );
+
 	void Recreate( 
 		const MicroVulkanWindow& window,
 		MicroVulkanRenderContext& render_context
@@ -157,6 +200,10 @@ public:
 
 	const MicroVulkanStagings& GetStaging( ) const;
 
+	MicroVulkanTextureCache& GetTextureCache( );
+
+	const MicroVulkanTextureCache& GetTextureCache( ) const;
+
 	MicroVulkanCommands& GetCommands( );
 
 	const MicroVulkanCommands& GetCommands( ) const;
@@ -180,8 +227,28 @@ public:
 		const uint32_t frame_id
 	) const;
 
+	MicroVulkanPipelines& GetPipelines( );
+
 	const MicroVulkanPipelines& GetPipelines( ) const;
 
+	MicroVulkanPipelineRegistry& GetPipelineRegistry( );
+
+	const MicroVulkanPipelineRegistry& GetPipelineRegistry( ) const;
+
+	MicroVulkanShaderRegistry& GetShaderRegistry( );
+
+	const MicroVulkanShaderRegistry& GetShaderRegistry( ) const;
+
+	MicroVulkanDescriptorAllocator& GetDescriptorAllocator( );
+
+	const MicroVulkanDescriptorAllocator& GetDescriptorAllocator( ) const;
+
+	MicroVulkanBindless& GetBindless( );
+
+	const MicroVulkanBindless& GetBindless( ) const;
+
+	uint32_t GetFrameCount( ) const;
+
 	const VkPipelineCache& GetPipelineCache( ) const;
 
 };
@@ -50,15 +50,19 @@ micro_struct MicroVulkanFrameTargetTexture {
 	bool Create(
 		const MicroVulkanDevice& device,
 		const MicroVulkanQueues& queues,
+		MicroVulkanTextureCache& cache,
 		const MicroVulkanTextureSpecification& specification
 	) {
 		Format = specification.Properties.Format;
 
-		return Texture.Create( device, queues, specification );
+		return Texture.Create( device, queues, cache, specification );
 	};
 
-	void Destroy( const MicroVulkanDevice& device ) {
-		Texture.Destroy( device );
+	void Destroy(
+		const MicroVulkanDevice& device,
+		MicroVulkanTextureCache& cache
+	) {
+		Texture.Destroy( device, cache );
 	};
 
 	VkImageView GetView( ) const {
@@ -43,6 +43,7 @@ bool MicroVulkanFramebuffers::Create(
     const MicroVulkanWindow& window,
 	const MicroVulkanDevice& device,
     const MicroVulkanQueues& queues,
+    MicroVulkanTextureCache& cache,
     const MicroVulkanSwapchain& swapchain,
     const MicroVulkanRenderPasses& passes,
     const MicroVulkanSpecification& specification
@@ -51,21 +52,22 @@ bool MicroVulkanFramebuffers::Create(
 
     GetRenderFramebuffersSpec( specification );
 
-    return CreateFramebuffers( device, queues, swapchain, passes, specification, dimensions_spec );
+    return CreateFramebuffers( device, queues, cache, swapchain, passes, specification, dimensions_spec );
 }
 
 void MicroVulkanFramebuffers::Recreate(
     const MicroVulkanDevice& device,
     const MicroVulkanQueues& queues,
+    MicroVulkanTextureCache& cache,
     const MicroVulkanSwapchain& swapchain,
     const MicroVulkanRenderPasses& passes,
     const micro_upoint& dimensions
 ) {
     auto dimensions_spec = CreateDimensionsSpec( dimensions );
 
-    Destroy( device );
+    Destroy( device, cache );
 
-    RecreateFramebuffers( device, queues, swapchain, passes, dimensions );
+    RecreateFramebuffers( device, queues, cache, swapchain, passes, dimensions );
 }
 
 void MicroVulkanFramebuffers::SetClearValue(
@@ -126,12 +128,15 @@ MicroVulkanRenderPassInfo MicroVulkanFramebuffers::AcquireRenderPass(
     return render_pass_info;
 }
 
-void MicroVulkanFramebuffers::Destroy( const MicroVulkanDevice& device ) {
+void MicroVulkanFramebuffers::Destroy(
+    const MicroVulkanDevice& device,
+    MicroVulkanTextureCache& cache
+) {
     auto frame_id = (uint32_t)0;
 
     for ( auto& framebuffer : m_framebuffers ) {
         for ( auto& target : framebuffer.Targets )
-            DestroyFramebuffer( device, frame_id, target );
+            DestroyFramebuffer( device, cache, frame_id, target );
 
         frame_id += 1;
     }
@@ -207,6 +212,7 @@ MicroVulkanTextureSpecification MicroVulkanFramebuffers::CreateTextureSpec(
 bool MicroVulkanFramebuffers::CreateFramebufferSwapchain(
     const MicroVulkanDevice& device,
     const MicroVulkanQueues& queues,
+    MicroVulkanTextureCache& cache,
     const std::vector<VkAttachmentDescription>& attachements_spec,
     const MicroVulkanSwapchainImage& swapchain_image,
     const micro_upoint& dimensions,
@@ -220,7 +226,7 @@ bool MicroVulkanFramebuffers::CreateFramebufferSwapchain(
     while ( result && texture_id-- > 1 ) {
         auto texture_spec = CreateTextureSpec( dimensions, attachements_spec[ texture_id ].format );
 
-        result = target.Textures[ texture_id ].Create( device, queues, texture_spec );
+        result = target.Textures[ texture_id ].Create( device, queues, cache, texture_spec );
     }
 
     target.Textures[ 0 ].Create( swapchain_image );
@@ -231,6 +237,7 @@ bool MicroVulkanFramebuffers::CreateFramebufferSwapchain(
 bool MicroVulkanFramebuffers::CreateFramebufferTextures(
     const MicroVulkanDevice& device,
     const MicroVulkanQueues& queues,
+    MicroVulkanTextureCache& cache,
     const std::vector<VkAttachmentDescription>& attachements_spec,
     const micro_upoint& dimensions,
     MicroVulkanFrameTarget& target
@@ -243,7 +250,7 @@ bool MicroVulkanFramebuffers::CreateFramebufferTextures(
     while ( result && texture_id-- > 0 ) {
         auto texture_spec = CreateTextureSpec( dimensions, attachements_spec[ texture_id ].format );
 
-        result = target.Textures[ texture_id ].Create( device, queues, texture_spec );
+        result = target.Textures[ texture_id ].Create( device, queues, cache, texture_spec );
     }
 
     return result;
@@ -252,6 +259,7 @@ bool MicroVulkanFramebuffers::CreateFramebufferTextures(
 void MicroVulkanFramebuffers::RecreateFramebufferTextures(
     const MicroVulkanDevice& device,
     const MicroVulkanQueues& queues,
+    MicroVulkanTextureCache& cache,
     const MicroVulkanSwapchainImage& image,
     const uint32_t render_pass_id,
     const micro_upoint& dimensions,
@@ -262,7 +270,7 @@ void MicroVulkanFramebuffers::RecreateFramebufferTextures(
     while ( texture_id-- > ( render_pass_id > 0 ? 0 : 1 ) ) {
         auto texture_spec = CreateTextureSpec( dimensions, target.Textures[ texture_id ].Format );
 
-        target.Textures[ texture_id ].Create( device, queues, texture_spec );
+        target.Textures[ texture_id ].Create( device, queues, cache, texture_spec );
     }
 
     if ( render_pass_id == 0 )
@@ -316,6 +324,7 @@ bool MicroVulkanFramebuffers::CreateFramebuffer(
 bool MicroVulkanFramebuffers::CreateFramebuffers(
     const MicroVulkanDevice& device,
     const MicroVulkanQueues& queues,
+    MicroVulkanTextureCache& cache,
     const MicroVulkanSwapchain& swapchain,
     const MicroVulkanRenderPasses& passes,
     const MicroVulkanSpecification& specification,
@@ -344,10 +353,10 @@ bool MicroVulkanFramebuffers::CreateFramebuffers(
             if ( render_pass_id == 0 ) {
                 auto frame_texture = swapchain.GetImages( );
 
-                result = CreateFramebufferSwapchain( device, queues, render_pass_spec.Attachements, frame_texture[ framebuffer_id ], dimensions, target ) &&
+                result = CreateFramebufferSwapchain( device, queues, cache, render_pass_spec.Attachements, frame_texture[ framebuffer_id ], dimensions, target ) &&
                          CreateFramebuffer( device, render_pass, dimensions, target );
             } else {
-                result = CreateFramebufferTextures( device, queues, render_pass_spec.Attachements, dimensions, target ) &&
+                result = CreateFramebufferTextures( device, queues, cache, render_pass_spec.Attachements, dimensions, target ) &&
                          CreateFramebuffer( device, render_pass, dimensions, target );;
             }
         }
@@ -359,6 +368,7 @@ bool MicroVulkanFramebuffers::CreateFramebuffers(
 void MicroVulkanFramebuffers::RecreateFramebuffers(
     const MicroVulkanDevice& device,
     const MicroVulkanQueues& queues,
+    MicroVulkanTextureCache& cache,
     const MicroVulkanSwapchain& swapchain,
     const MicroVulkanRenderPasses& passes,
     const micro_upoint& dimensions
@@ -373,7 +383,7 @@ void MicroVulkanFramebuffers::RecreateFramebuffers(
         framebuffer.Dimensions = dimensions;
 
         for ( auto& target : framebuffer.Targets ) {
-            RecreateFramebufferTextures( device, queues, frame_texture[ target_id++ ], render_pass_id, dimensions, target );
+            RecreateFramebufferTextures( device, queues, cache, frame_texture[ target_id++ ], render_pass_id, dimensions, target );
 
             CreateFramebuffer( device, render_pass, dimensions, target );
         }
@@ -384,14 +394,15 @@ void MicroVulkanFramebuffers::RecreateFramebuffers(
 
 void MicroVulkanFramebuffers::DestroyFramebuffer(
     const MicroVulkanDevice& device,
+    MicroVulkanTextureCache& cache,
     const uint32_t frame_id,
     MicroVulkanFrameTarget& target
 ) {
     auto target_id = (uint32_t)0;
 
     for ( auto& texture : target.Textures ) {
-        if ( frame_id != 0 && target_id != 0 )
-            texture.Destroy( device );
+        if ( frame_id != 0 || target_id != 0 )
+            texture.Destroy( device, cache );
 
         target_id += 1;
     }
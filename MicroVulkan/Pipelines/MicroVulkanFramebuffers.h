@@ -48,6 +48,7 @@ public:
 		const MicroVulkanWindow& window,
 		const MicroVulkanDevice& device,
 		const MicroVulkanQueues& queues,
+		MicroVulkanTextureCache& cache,
 		const MicroVulkanSwapchain& swapchain,
 		const MicroVulkanRenderPasses& passes,
 		const MicroVulkanSpecification& specification
@@ -56,6 +57,7 @@ public:
 	void Recreate( 
 		const MicroVulkanDevice& device,
 		const MicroVulkanQueues& queues,
+		MicroVulkanTextureCache& cache,
 		const MicroVulkanSwapchain& swapchain,
 		const MicroVulkanRenderPasses& passes,
 		const micro_upoint& dimensions
@@ -78,7 +80,10 @@ public:
 		const VkRenderPass render_pass
 	);
 
-	void Destroy( const MicroVulkanDevice& device );
+	void Destroy(
+		const MicroVulkanDevice& device,
+		MicroVulkanTextureCache& cache
+	);
 
 private:
 	micro_upoint CreateDimensionsSpec( const MicroVulkanWindow& window );
@@ -97,6 +102,7 @@ private:
 	bool CreateFramebufferSwapchain(
 		const MicroVulkanDevice& device, 
 		const MicroVulkanQueues& queues,
+		MicroVulkanTextureCache& cache,
 		const std::vector<VkAttachmentDescription>& attachements_spec,
 		const MicroVulkanSwapchainImage& swapchain_image,
 		const micro_upoint& dimensions,
@@ -106,6 +112,7 @@ private:
 	bool CreateFramebufferTextures(
 		const MicroVulkanDevice& device,
 		const MicroVulkanQueues& queues,
+		MicroVulkanTextureCache& cache,
 		const std::vector<VkAttachmentDescription>& attachements_spec,
 		const micro_upoint& dimensions,
 		MicroVulkanFrameTarget& target
@@ -114,6 +121,7 @@ private:
 	void RecreateFramebufferTextures(
 		const MicroVulkanDevice& device,
 		const MicroVulkanQueues& queues,
+		MicroVulkanTextureCache& cache,
 		const MicroVulkanSwapchainImage& image,
 		const uint32_t render_pass_id,
 		const micro_upoint& dimensions,
@@ -140,6 +148,7 @@ private:
 	bool CreateFramebuffers( 
 		const MicroVulkanDevice& device,
 		const MicroVulkanQueues& queues,
+		MicroVulkanTextureCache& cache,
 		const MicroVulkanSwapchain& swapchain,
 		const MicroVulkanRenderPasses& passes,
 		const MicroVulkanSpecification& specification,
@@ -149,6 +158,7 @@ private:
 	void RecreateFramebuffers(
 		const MicroVulkanDevice& device,
 		const MicroVulkanQueues& queues,
+		MicroVulkanTextureCache& cache,
 		const MicroVulkanSwapchain& swapchain,
 		const MicroVulkanRenderPasses& passes,
 		const micro_upoint& dimensions
@@ -156,6 +166,7 @@ private:
 
 	void DestroyFramebuffer( 
 		const MicroVulkanDevice& device,
+		MicroVulkanTextureCache& cache,
 		const uint32_t frame_id,
 		MicroVulkanFrameTarget& target
 	);
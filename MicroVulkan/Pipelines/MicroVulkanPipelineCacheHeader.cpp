@@ -36,7 +36,14 @@
 ////////////////////////////////////////////////////////////////////////////////////////////
 MicroVulkanPipelineCacheHeader::MicroVulkanPipelineCacheHeader( ) 
 	: Magic{ },
+	Version{ },
 	Vendor{ },
 	Device{ },
-	CRC{ }
+	Driver{ },
+	Compression{ },
+	UUID{ },
+	Length{ },
+	RawLength{ },
+	CRC{ },
+	Reserved{ }
 { }
@@ -36,9 +36,16 @@
 micro_struct MicroVulkanPipelineCacheHeader {
 
 	uint32_t Magic;
+	uint32_t Version;
 	uint32_t Vendor;
 	uint32_t Device;
+	uint32_t Driver;
+	uint32_t Compression;
+	uint8_t UUID[ VK_UUID_SIZE ];
+	uint64_t Length;
+	uint64_t RawLength;
 	uint32_t CRC;
+	uint32_t Reserved;
 
 	MicroVulkanPipelineCacheHeader( );
 
@@ -0,0 +1,425 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "__micro_vulkan_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+MicroVulkanPipelineRegistry::MicroVulkanPipelineRegistry( )
+	: m_pipelines{ },
+	m_pipeline_hashes{ },
+	m_shader_objects{ },
+	m_shader_object_hashes{ },
+	m_layouts{ },
+	m_layout_hashes{ },
+	m_descriptor_layouts{ },
+	m_descriptor_layout_hashes{ },
+	m_hits{ 0 },
+	m_misses{ 0 },
+	m_mutex{ }
+{ }
+
+bool MicroVulkanPipelineRegistry::Acquire( const uint64_t hash, VkPipeline& pipeline ) {
+	auto lock = std::unique_lock{ m_mutex };
+
+	auto entry = m_pipelines.find( hash );
+
+	if ( entry == m_pipelines.end( ) ) {
+		m_misses += 1;
+
+		return false;
+	}
+
+	entry->second.References += 1;
+
+	pipeline = entry->second.Pipeline;
+	m_hits  += 1;
+
+	return true;
+}
+
+bool MicroVulkanPipelineRegistry::Acquire( const uint64_t hash, VkShaderEXT& shader ) {
+	auto lock = std::unique_lock{ m_mutex };
+
+	auto entry = m_shader_objects.find( hash );
+
+	if ( entry == m_shader_objects.end( ) ) {
+		m_misses += 1;
+
+		return false;
+	}
+
+	entry->second.References += 1;
+
+	shader  = entry->second.Shader;
+	m_hits += 1;
+
+	return true;
+}
+
+bool MicroVulkanPipelineRegistry::Acquire( const uint64_t hash, VkPipelineLayout& layout ) {
+	auto lock = std::unique_lock{ m_mutex };
+
+	auto entry = m_layouts.find( hash );
+
+	if ( entry == m_layouts.end( ) )
+		return false;
+
+	entry->second.References += 1;
+
+	layout = entry->second.Layout;
+
+	return true;
+}
+
+bool MicroVulkanPipelineRegistry::Acquire(
+	const MicroVulkanDevice& device,
+	const std::vector<VkDescriptorSetLayoutBinding>& bindings,
+	VkDescriptorSetLayout& layout
+) {
+	auto hash = MicroVulkanHash{ };
+
+	hash.Combine( bindings );
+
+	auto lock  = std::unique_lock{ m_mutex };
+	auto entry = m_descriptor_layouts.find( hash );
+
+	if ( entry != m_descriptor_layouts.end( ) ) {
+		entry->second.References += 1;
+
+		layout = entry->second.Layout;
+
+		return true;
+	}
+
+	auto layout_spec = VkDescriptorSetLayoutCreateInfo{ };
+
+	layout_spec.sType		 = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+	layout_spec.pNext		 = VK_NULL_HANDLE;
+	layout_spec.flags		 = VK_UNUSED_FLAG;
+	layout_spec.bindingCount = (uint32_t)bindings.size( );
+	layout_spec.pBindings	 = bindings.data( );
+
+	if ( vk::CreateDescriptorSetLayout( device, layout_spec, layout ) != VK_SUCCESS )
+		return false;
+
+	// Bindings are kept so pipelines built on this layout can be described
+	// again in the warm-up manifest.
+	m_descriptor_layouts.emplace( hash, MicroVulkanDescriptorLayoutEntry{ layout, bindings, 1 } );
+	m_descriptor_layout_hashes.emplace( layout, hash );
+
+	return true;
+}
+
+void MicroVulkanPipelineRegistry::Register(
+	const MicroVulkanDevice& device,
+	const uint64_t hash,
+	VkPipeline& pipeline
+) {
+	auto lock = std::unique_lock{ m_mutex };
+
+	auto entry = m_pipelines.find( hash );
+
+	// An identical pipeline registered in the meantime wins, the duplicate
+	// is destroyed so every material shares the same handle.
+	if ( entry != m_pipelines.end( ) ) {
+		vk::DestroyPipeline( device, pipeline );
+
+		entry->second.References += 1;
+
+		pipeline = entry->second.Pipeline;
+	} else if ( vk::IsValid( pipeline ) ) {
+		m_pipelines.emplace( hash, MicroVulkanPipelineEntry{ pipeline, 1 } );
+		m_pipeline_hashes.emplace( pipeline, hash );
+	}
+}
+
+void MicroVulkanPipelineRegistry::Register(
+	const MicroVulkanDevice& device,
+	const uint64_t hash,
+	VkShaderEXT& shader
+) {
+	auto lock = std::unique_lock{ m_mutex };
+
+	auto entry = m_shader_objects.find( hash );
+
+	if ( entry != m_shader_objects.end( ) ) {
+		vk::DestroyShaderObject( device, shader );
+
+		entry->second.References += 1;
+
+		shader = entry->second.Shader;
+	} else if ( vk::IsValid( shader ) ) {
+		m_shader_objects.emplace( hash, MicroVulkanShaderObjectEntry{ shader, 1 } );
+		m_shader_object_hashes.emplace( shader, hash );
+	}
+}
+
+void MicroVulkanPipelineRegistry::Register(
+	const MicroVulkanDevice& device,
+	const uint64_t hash,
+	VkPipelineLayout& layout
+) {
+	auto lock = std::unique_lock{ m_mutex };
+
+	auto entry = m_layouts.find( hash );
+
+	if ( entry != m_layouts.end( ) ) {
+		vk::DestroyPipelineLayout( device, layout );
+
+		entry->second.References += 1;
+
+		layout = entry->second.Layout;
+	} else if ( vk::IsValid( layout ) ) {
+		m_layouts.emplace( hash, MicroVulkanPipelineLayoutEntry{ layout, 1 } );
+		m_layout_hashes.emplace( layout, hash );
+	}
+}
+
+void MicroVulkanPipelineRegistry::Release(
+	const MicroVulkanDevice& device,
+	VkPipeline& pipeline
+) {
+	auto lock = std::unique_lock{ m_mutex };
+
+	auto hash = m_pipeline_hashes.find( pipeline );
+
+	if ( hash == m_pipeline_hashes.end( ) ) {
+		vk::DestroyPipeline( device, pipeline );
+
+		return;
+	}
+
+	auto& entry = m_pipelines[ hash->second ];
+
+	if ( --entry.References == 0 ) {
+		vk::DestroyPipeline( device, entry.Pipeline );
+
+		m_pipelines.erase( hash->second );
+		m_pipeline_hashes.erase( hash );
+	}
+
+	pipeline = VK_NULL_HANDLE;
+}
+
+void MicroVulkanPipelineRegistry::Release(
+	const MicroVulkanDevice& device,
+	VkShaderEXT& shader
+) {
+	auto lock = std::unique_lock{ m_mutex };
+
+	auto hash = m_shader_object_hashes.find( shader );
+
+	if ( hash == m_shader_object_hashes.end( ) ) {
+		vk::DestroyShaderObject( device, shader );
+
+		return;
+	}
+
+	auto& entry = m_shader_objects[ hash->second ];
+
+	if ( --entry.References == 0 ) {
+		vk::DestroyShaderObject( device, entry.Shader );
+
+		m_shader_objects.erase( hash->second );
+		m_shader_object_hashes.erase( hash );
+	}
+
+	shader = VK_NULL_HANDLE;
+}
+
+void MicroVulkanPipelineRegistry::Release(
+	const MicroVulkanDevice& device,
+	VkPipelineLayout& layout
+) {
+	auto lock = std::unique_lock{ m_mutex };
+
+	auto hash = m_layout_hashes.find( layout );
+
+	if ( hash == m_layout_hashes.end( ) ) {
+		vk::DestroyPipelineLayout( device, layout );
+
+		return;
+	}
+
+	auto& entry = m_layouts[ hash->second ];
+
+	if ( --entry.References == 0 ) {
+		vk::DestroyPipelineLayout( device, entry.Layout );
+
+		m_layouts.erase( hash->second );
+		m_layout_hashes.erase( hash );
+	}
+
+	layout = VK_NULL_HANDLE;
+}
+
+void MicroVulkanPipelineRegistry::Release(
+	const MicroVulkanDevice& device,
+	VkDescriptorSetLayout& layout
+) {
+	auto lock = std::unique_lock{ m_mutex };
+
+	auto hash = m_descriptor_layout_hashes.find( layout );
+
+	if ( hash == m_descriptor_layout_hashes.end( ) ) {
+		vk::DestroyDescriptorSetLayout( device, layout );
+
+		return;
+	}
+
+	auto& entry = m_descriptor_layouts[ hash->second ];
+
+	if ( --entry.References == 0 ) {
+		vk::DestroyDescriptorSetLayout( device, entry.Layout );
+
+		m_descriptor_layouts.erase( hash->second );
+		m_descriptor_layout_hashes.erase( hash );
+	}
+
+	layout = VK_NULL_HANDLE;
+}
+
+uint64_t MicroVulkanPipelineRegistry::CreateLayoutHash(
+	const std::vector<VkDescriptorSetLayout>& layouts,
+	const std::vector<VkPushConstantRange>& push_constants,
+	const bool bindless
+) const {
+	auto hash	  = MicroVulkanHash{ };
+	auto bindings = std::vector<VkDescriptorSetLayoutBinding>{ };
+
+	// Released handles can be handed out again, set layouts are hashed by
+	// their bindings so a recycled handle never matches a stale layout.
+	hash.Combine( bindless );
+	hash.Combine( (uint64_t)layouts.size( ) );
+
+	for ( auto& layout : layouts ) {
+		if ( !GetBindings( layout, bindings ) ) {
+			hash.Combine( layout );
+
+			continue;
+		}
+
+		hash.Combine( (uint64_t)bindings.size( ) );
+
+		for ( auto& binding : bindings ) {
+			hash.Combine( binding.binding );
+			hash.Combine( binding.descriptorType );
+			hash.Combine( binding.descriptorCount );
+			hash.Combine( binding.stageFlags );
+		}
+	}
+
+	hash.Combine( push_constants );
+
+	return hash;
+}
+
+void MicroVulkanPipelineRegistry::Destroy( const MicroVulkanDevice& device ) {
+	auto lock = std::unique_lock{ m_mutex };
+
+	for ( auto& [ hash, entry ] : m_pipelines )
+		vk::DestroyPipeline( device, entry.Pipeline );
+
+	for ( auto& [ hash, entry ] : m_shader_objects )
+		vk::DestroyShaderObject( device, entry.Shader );
+
+	for ( auto& [ hash, entry ] : m_layouts )
+		vk::DestroyPipelineLayout( device, entry.Layout );
+
+	for ( auto& [ hash, entry ] : m_descriptor_layouts )
+		vk::DestroyDescriptorSetLayout( device, entry.Layout );
+
+	m_pipelines.clear( );
+	m_pipeline_hashes.clear( );
+	m_shader_objects.clear( );
+	m_shader_object_hashes.clear( );
+	m_layouts.clear( );
+	m_layout_hashes.clear( );
+	m_descriptor_layouts.clear( );
+	m_descriptor_layout_hashes.clear( );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t MicroVulkanPipelineRegistry::GetHitCount( ) const {
+	auto lock = std::unique_lock{ m_mutex };
+
+	return m_hits;
+}
+
+uint32_t MicroVulkanPipelineRegistry::GetMissCount( ) const {
+	auto lock = std::unique_lock{ m_mutex };
+
+	return m_misses;
+}
+
+uint32_t MicroVulkanPipelineRegistry::GetPipelineCount( ) const {
+	auto lock = std::unique_lock{ m_mutex };
+
+	return (uint32_t)m_pipelines.size( );
+}
+
+uint32_t MicroVulkanPipelineRegistry::GetShaderObjectCount( ) const {
+	auto lock = std::unique_lock{ m_mutex };
+
+	return (uint32_t)m_shader_objects.size( );
+}
+
+uint32_t MicroVulkanPipelineRegistry::GetLayoutCount( ) const {
+	auto lock = std::unique_lock{ m_mutex };
+
+	return (uint32_t)m_layouts.size( );
+}
+
+uint32_t MicroVulkanPipelineRegistry::GetDescriptorLayoutCount( ) const {
+	auto lock = std::unique_lock{ m_mutex };
+
+	return (uint32_t)m_descriptor_layouts.size( );
+}
+
+bool MicroVulkanPipelineRegistry::GetBindings(
+	const VkDescriptorSetLayout layout,
+	std::vector<VkDescriptorSetLayoutBinding>& bindings
+) const {
+	auto lock = std::unique_lock{ m_mutex };
+
+	auto hash = m_descriptor_layout_hashes.find( layout );
+
+	if ( hash == m_descriptor_layout_hashes.end( ) )
+		return false;
+
+	bindings = m_descriptor_layouts.at( hash->second ).Bindings;
+
+	return true;
+}
@@ -0,0 +1,149 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "MicroVulkanPipelines.h"
+
+micro_struct MicroVulkanPipelineEntry {
+
+	VkPipeline Pipeline;
+	uint32_t References;
+
+};
+
+micro_struct MicroVulkanShaderObjectEntry {
+
+	VkShaderEXT Shader;
+	uint32_t References;
+
+};
+
+micro_struct MicroVulkanPipelineLayoutEntry {
+
+	VkPipelineLayout Layout;
+	uint32_t References;
+
+};
+
+micro_struct MicroVulkanDescriptorLayoutEntry {
+
+	VkDescriptorSetLayout Layout;
+	std::vector<VkDescriptorSetLayoutBinding> Bindings;
+	uint32_t References;
+
+};
+
+micro_class MicroVulkanPipelineRegistry final {
+
+private:
+	std::unordered_map<uint64_t, MicroVulkanPipelineEntry> m_pipelines;
+	std::unordered_map<VkPipeline, uint64_t> m_pipeline_hashes;
+	std::unordered_map<uint64_t, MicroVulkanShaderObjectEntry> m_shader_objects;
+	std::unordered_map<VkShaderEXT, uint64_t> m_shader_object_hashes;
+	std::unordered_map<uint64_t, MicroVulkanPipelineLayoutEntry> m_layouts;
+	std::unordered_map<VkPipelineLayout, uint64_t> m_layout_hashes;
+	std::unordered_map<uint64_t, MicroVulkanDescriptorLayoutEntry> m_descriptor_layouts;
+	std::unordered_map<VkDescriptorSetLayout, uint64_t> m_descriptor_layout_hashes;
+	uint32_t m_hits;
+	uint32_t m_misses;
+	mutable std::mutex m_mutex;
+
+public:
+	MicroVulkanPipelineRegistry( );
+
+	~MicroVulkanPipelineRegistry( ) = default;
+
+	bool Acquire( const uint64_t hash, VkPipeline& pipeline );
+
+	bool Acquire( const uint64_t hash, VkShaderEXT& shader );
+
+	bool Acquire( const uint64_t hash, VkPipelineLayout& layout );
+
+	bool Acquire(
+		const MicroVulkanDevice& device,
+		const std::vector<VkDescriptorSetLayoutBinding>& bindings,
+		VkDescriptorSetLayout& layout
+	);
+
+	void Register(
+		const MicroVulkanDevice& device,
+		const uint64_t hash,
+		VkPipeline& pipeline
+	);
+
+	void Register(
+		const MicroVulkanDevice& device,
+		const uint64_t hash,
+		VkShaderEXT& shader
+	);
+
+	void Register(
+		const MicroVulkanDevice& device,
+		const uint64_t hash,
+		VkPipelineLayout& layout
+	);
+
+	void Release( const MicroVulkanDevice& device, VkPipeline& pipeline );
+
+	void Release( const MicroVulkanDevice& device, VkShaderEXT& shader );
+
+	void Release( const MicroVulkanDevice& device, VkPipelineLayout& layout );
+
+	void Release( const MicroVulkanDevice& device, VkDescriptorSetLayout& layout );
+
+	uint64_t CreateLayoutHash(
+		const std::vector<VkDescriptorSetLayout>& layouts,
+		const std::vector<VkPushConstantRange>& push_constants,
+		const bool bindless
+	) const;
+
+	void Destroy( const MicroVulkanDevice& device );
+
+public:
+	uint32_t GetHitCount( ) const;
+
+	uint32_t GetMissCount( ) const;
+
+	uint32_t GetPipelineCount( ) const;
+
+	uint32_t GetShaderObjectCount( ) const;
+
+	uint32_t GetLayoutCount( ) const;
+
+	uint32_t GetDescriptorLayoutCount( ) const;
+
+	bool GetBindings(
+		const VkDescriptorSetLayout layout,
+		std::vector<VkDescriptorSetLayoutBinding>& bindings
+	) const;
+
+};
@@ -35,16 +35,35 @@
 
 micro_class MicroVulkanPipelines final {
 
-	constexpr static uint32_t CACHE_MAGIC = 0x434B564D;
+	constexpr static uint32_t CACHE_MAGIC		  = 0x434B564D;
+	constexpr static uint32_t CACHE_VERSION		  = 2;
+	constexpr static uint32_t CACHE_COMPRESS_NONE = 0;
+	constexpr static uint32_t CACHE_COMPRESS_ZSTD = 1;
+	constexpr static uint32_t MANIFEST_MAGIC	  = 0x464D564D;
+	constexpr static uint32_t MANIFEST_VERSION	  = 3;
 
 private:
 	std::string m_path;
+	std::string m_manifest_path;
 	VkPipelineCache m_cache;
+	MicroVulkanChecksum m_checksum;
+	uint32_t m_saved_crc;
+	uint32_t m_interval;
+	uint32_t m_threshold;
+	uint32_t m_created;
+	bool m_is_running;
+	std::thread m_checkpoint;
+	mutable std::mutex m_mutex;
+	std::condition_variable m_condition;
+	std::unordered_map<uint64_t, std::vector<uint8_t>> m_manifest;
+	bool m_manifest_changed;
 	mutable std::map<VkDescriptorType, uint32_t> m_limits;
 
 public:
 	MicroVulkanPipelines( );
 
+	MicroVulkanPipelines( const MicroVulkanPipelines& ) = delete;
+
 	~MicroVulkanPipelines( ) = default;
 	
 	bool Create(
@@ -52,19 +71,34 @@ public:
 		const MicroVulkanSpecification& specification
 	);
 
+	void Notify( );
+
+	void Record( std::vector<uint8_t>&& entry );
+
 	void Destroy( const MicroVulkanDevice& device );
 
 private:
-	uint32_t CaculateCRC( const std::vector<uint8_t>& cache_data );
+	uint32_t CaculateCRC( const uint8_t* data, const uint64_t length );
 
-	std::vector<uint8_t> LoadCache( 
+	const uint8_t* LoadPayload(
+		const MicroVulkanMappedFile& file,
+		const MicroVulkanPipelineCacheHeader& header,
+		std::vector<uint8_t>& buffer,
+		uint64_t& length
+	);
+
+	const uint8_t* LoadCache( 
 		const MicroVulkanDevice& device,
-		const MicroVulkanSpecification& specification
+		const MicroVulkanSpecification& specification,
+		const MicroVulkanMappedFile& file,
+		std::vector<uint8_t>& buffer,
+		uint64_t& length
 	);
 
 	VkPipelineCacheCreateInfo CreateCacheSpec(
 		const MicroVulkanSpecification& specification,
-		const std::vector<uint8_t>& cache_data
+		const uint8_t* cache_data,
+		const uint64_t length
 	);
 
 	bool CreateCache( 
@@ -72,15 +106,41 @@ private:
 		const MicroVulkanSpecification& specification
 	);
 
+	void LoadManifest( );
+
 	void CreateLimtis( const MicroVulkanDevice& device );
 
 	MicroVulkanPipelineCacheHeader CreateCacheHeader(
 		const MicroVulkanDevice& device,
-		const std::vector<uint8_t>& cache_data
+		const std::vector<uint8_t>& cache_data,
+		const std::vector<uint8_t>& payload,
+		const uint32_t compression
+	);
+
+	uint32_t CompressCache(
+		const std::vector<uint8_t>& cache_data,
+		std::vector<uint8_t>& payload
+	);
+
+	bool WriteCache(
+		const std::string& path,
+		const MicroVulkanPipelineCacheHeader& header,
+		const std::vector<uint8_t>& payload
 	);
 
 	void SaveCache( const MicroVulkanDevice& device );
 
+	void SaveManifest( const MicroVulkanDevice& device );
+
+	void CreateCheckpoint(
+		const MicroVulkanDevice& device,
+		const MicroVulkanSpecification& specification
+	);
+
+	void RunCheckpoint( const MicroVulkanDevice& device );
+
+	void DestroyCheckpoint( );
+
 public:
 	const VkPipelineCache& GetCache( ) const;
 
@@ -88,4 +148,12 @@ public:
 
 	uint32_t GetLimit( const VkDescriptorType type ) const;
 
+	std::vector<std::vector<uint8_t>> GetManifest( ) const;
+
+private:
+	bool GetIsCompatible(
+		const MicroVulkanDevice& device,
+		const MicroVulkanPipelineCacheHeader& header
+	) const;
+
 };
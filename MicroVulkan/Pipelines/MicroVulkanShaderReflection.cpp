@@ -0,0 +1,498 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#include "__micro_vulkan_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+MicroVulkanShaderReflection::MicroVulkanShaderReflection( )
+	: m_sets{ },
+	m_push_constants{ },
+	m_local_size{ 0, 0, 0 },
+	m_local_ids{ }
+{ }
+
+bool MicroVulkanShaderReflection::Append(
+	const VkShaderStageFlagBits stage,
+	const std::vector<uint32_t>& code
+) {
+	auto module = MicroVulkanSpirvModule{ };
+
+	if ( !CreateModule( code, module ) )
+		return false;
+
+	if ( stage == VK_SHADER_STAGE_COMPUTE_BIT && module.LocalSize.size( ) == 3 ) {
+		m_local_size.width	= GetLocalAxis( module, 0 );
+		m_local_size.height = GetLocalAxis( module, 1 );
+		m_local_size.depth	= GetLocalAxis( module, 2 );
+
+		m_local_ids = { GetLocalId( module, 0 ), GetLocalId( module, 1 ), GetLocalId( module, 2 ) };
+	}
+
+	for ( auto& variable : module.Variables ) {
+		auto storage = variable[ 3 ];
+
+		if ( storage == STORAGE_PUSH_CONSTANT ) {
+			auto* pointer = GetType( module, variable[ 1 ] );
+
+			if ( pointer != nullptr && pointer->size( ) > 3 )
+				AppendPushConstant( stage, module, pointer->at( 3 ) );
+		} else if ( 
+			( storage == STORAGE_UNIFORM_CONSTANT || storage == STORAGE_UNIFORM || storage == STORAGE_STORAGE_BUFFER ) &&
+			!AppendBinding( stage, module, variable )
+		)
+			return false;
+	}
+
+	return true;
+}
+
+bool MicroVulkanShaderReflection::Acquire(
+	const MicroVulkanDevice& device,
+	MicroVulkanPipelineRegistry& registry,
+	const uint32_t first_set,
+	std::vector<VkDescriptorSetLayout>& layouts
+) const {
+	auto set_count = GetSetCount( );
+
+	// Unused set ids between two used ones still need a layout, an empty
+	// one keeps the set numbering of the shaders.
+	for ( auto set_id = first_set; set_id < set_count; set_id++ ) {
+		auto bindings = std::vector<VkDescriptorSetLayoutBinding>{ };
+		auto layout	  = VkDescriptorSetLayout{ VK_NULL_HANDLE };
+		auto set	  = m_sets.find( set_id );
+
+		if ( set != m_sets.end( ) ) {
+			for ( auto& [ binding_id, binding ] : set->second ) {
+				if ( binding.descriptorCount == 0 )
+					return false;
+
+				bindings.emplace_back( binding );
+			}
+		}
+
+		if ( !registry.Acquire( device, bindings, layout ) )
+			return false;
+
+		layouts.emplace_back( layout );
+	}
+
+	return true;
+}
+
+void MicroVulkanShaderReflection::Clear( ) {
+	m_sets.clear( );
+	m_push_constants.clear( );
+
+	m_local_size = { 0, 0, 0 };
+
+	m_local_ids.clear( );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool MicroVulkanShaderReflection::CreateModule(
+	const std::vector<uint32_t>& code,
+	MicroVulkanSpirvModule& module
+) {
+	if ( code.size( ) < SPIRV_HEADER || code[ 0 ] != SPIRV_MAGIC )
+		return false;
+
+	auto word_id = (size_t)SPIRV_HEADER;
+	auto builtin = (uint32_t)0;
+
+	// Only the declarations are kept, every instruction is skipped using
+	// the word count packed in its high half.
+	while ( word_id < code.size( ) ) {
+		auto opcode		= code[ word_id ] & 0xFFFF;
+		auto word_count = (size_t)( code[ word_id ] >> 16 );
+
+		if ( word_count == 0 || word_id + word_count > code.size( ) )
+			return false;
+
+		auto* words = code.data( ) + word_id;
+
+		// Flag decorations like BufferBlock carry no operand, they're kept
+		// with a zero value so lookups still find them.
+		if ( opcode == OP_DECORATE && word_count > 2 )
+			module.Decorations[ ( (uint64_t)words[ 1 ] << 32 ) | words[ 2 ] ] = ( word_count > 3 ) ? words[ 3 ] : 0;
+		else if ( opcode == OP_MEMBER_DECORATE && word_count > 4 ) {
+			auto member = ( (uint64_t)words[ 1 ] << 32 ) | words[ 2 ];
+
+			if ( words[ 3 ] == DECORATION_OFFSET )
+				module.Offsets[ member ] = words[ 4 ];
+			else if ( words[ 3 ] == DECORATION_MATRIX_STRIDE )
+				module.Strides[ member ] = words[ 4 ];
+		} else if ( ( opcode == OP_CONSTANT || opcode == OP_SPEC_CONSTANT ) && word_count > 3 )
+			module.Constants[ words[ 2 ] ] = words[ 3 ];
+		else if (
+			( opcode == OP_EXECUTION_MODE || opcode == OP_EXECUTION_MODE_ID ) && word_count > 5 &&
+			( words[ 2 ] == MODE_LOCAL_SIZE || words[ 2 ] == MODE_LOCAL_SIZE_ID )
+		) {
+			module.LocalSize.assign( words + 3, words + 6 );
+
+			module.IsLocalSizeId = words[ 2 ] == MODE_LOCAL_SIZE_ID;
+		} else if ( 
+			( opcode == OP_CONSTANT_COMPOSITE || opcode == OP_SPEC_CONSTANT_COMP ) && word_count > 5 &&
+			GetDecoration( module, words[ 2 ], DECORATION_BUILTIN, builtin ) && builtin == BUILTIN_WORKGROUP_SIZE
+		) {
+			// A WorkgroupSize constant overrides the execution mode, decorations
+			// come first in a module so it's already known here.
+			module.LocalSize.assign( words + 3, words + 6 );
+
+			module.IsLocalSizeId = true;
+		} else if ( opcode == OP_VARIABLE && word_count > 3 )
+			module.Variables.emplace_back( words, words + word_count );
+		else if ( opcode >= OP_TYPE_BOOL && opcode <= OP_TYPE_POINTER && word_count > 1 ) {
+			auto& type = module.Types[ words[ 1 ] ];
+
+			// Types keep the bare opcode as first word, lookups compare it
+			// without masking the word count.
+			type.assign( words, words + word_count );
+			type[ 0 ] = opcode;
+		}
+
+		word_id += word_count;
+	}
+
+	return true;
+}
+
+bool MicroVulkanShaderReflection::AppendBinding(
+	const VkShaderStageFlagBits stage,
+	const MicroVulkanSpirvModule& module,
+	const std::vector<uint32_t>& variable
+) {
+	auto binding = VkDescriptorSetLayoutBinding{ };
+	auto set_id	 = (uint32_t)0;
+	auto* type	 = GetType( module, variable[ 1 ] );
+
+	if (
+		type == nullptr || type->size( ) < 4 ||
+		!GetDecoration( module, variable[ 2 ], DECORATION_SET, set_id ) ||
+		!GetDecoration( module, variable[ 2 ], DECORATION_BINDING, binding.binding )
+	)
+		return true;
+
+	auto type_id  = type->at( 3 );
+	auto* pointee = GetType( module, type_id );
+
+	binding.descriptorCount	   = 1;
+	binding.stageFlags		   = stage;
+	binding.pImmutableSamplers = VK_NULL_HANDLE;
+
+	// Runtime arrays keep a zero count, their size is only known by the
+	// application so Acquire refuses to build a layout for them.
+	if ( pointee != nullptr && pointee->at( 0 ) == OP_TYPE_ARRAY ) {
+		auto length = module.Constants.find( pointee->at( 3 ) );
+
+		binding.descriptorCount = ( length != module.Constants.end( ) ) ? length->second : 0;
+		type_id					= pointee->at( 2 );
+	} else if ( pointee != nullptr && pointee->at( 0 ) == OP_TYPE_RUNTIME_ARRAY ) {
+		binding.descriptorCount = 0;
+		type_id					= pointee->at( 2 );
+	}
+
+	if ( !GetDescriptorType( module, variable[ 3 ], type_id, binding.descriptorType ) )
+		return false;
+
+	auto& set	 = m_sets[ set_id ];
+	auto current = set.find( binding.binding );
+
+	if ( current == set.end( ) ) {
+		set.emplace( binding.binding, binding );
+
+		return true;
+	}
+
+	// Stages sharing a binding must agree on it, the layout only merges
+	// their stage flags.
+	if (
+		current->second.descriptorType != binding.descriptorType ||
+		current->second.descriptorCount != binding.descriptorCount
+	)
+		return false;
+
+	current->second.stageFlags |= stage;
+
+	return true;
+}
+
+void MicroVulkanShaderReflection::AppendPushConstant(
+	const VkShaderStageFlagBits stage,
+	const MicroVulkanSpirvModule& module,
+	const uint32_t type
+) {
+	auto* block = GetType( module, type );
+
+	if ( block == nullptr || block->at( 0 ) != OP_TYPE_STRUCT )
+		return;
+
+	auto begin	   = UINT32_MAX;
+	auto end	   = (uint32_t)0;
+	auto member_id = (uint32_t)block->size( ) - 2;
+
+	while ( member_id-- > 0 ) {
+		auto member = ( (uint64_t)type << 32 ) | member_id;
+		auto offset = module.Offsets.find( member );
+		auto stride = module.Strides.find( member );
+
+		if ( offset == module.Offsets.end( ) )
+			continue;
+
+		auto matrix_stride = ( stride != module.Strides.end( ) ) ? stride->second : 0;
+		auto size		   = GetTypeSize( module, block->at( member_id + 2 ), matrix_stride );
+
+		begin = std::min( begin, offset->second );
+		end	  = std::max( end, offset->second + size );
+	}
+
+	if ( begin >= end )
+		return;
+
+	// Stages pushing the same block share one range, the layout stays
+	// compatible across materials using the same push constants.
+	for ( auto& range : m_push_constants ) {
+		if ( range.offset == begin && range.size == end - begin ) {
+			range.stageFlags |= stage;
+
+			return;
+		}
+	}
+
+	m_push_constants.emplace_back( VkPushConstantRange{ (VkShaderStageFlags)stage, begin, end - begin } );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+const std::vector<VkPushConstantRange>& MicroVulkanShaderReflection::GetPushConstants( ) const {
+	return m_push_constants;
+}
+
+uint32_t MicroVulkanShaderReflection::GetSetCount( ) const {
+	return m_sets.empty( ) ? 0 : m_sets.rbegin( )->first + 1;
+}
+
+const VkExtent3D& MicroVulkanShaderReflection::GetLocalSize( ) const {
+	return m_local_size;
+}
+
+VkExtent3D MicroVulkanShaderReflection::GetLocalSize( const VkSpecializationInfo& specialization ) const {
+	auto local_size = m_local_size;
+	auto* data		= micro_cast( specialization.pData, const uint8_t* );
+	auto entry_id	= specialization.mapEntryCount;
+
+	if ( m_local_ids.size( ) < 3 )
+		return local_size;
+
+	while ( entry_id-- > 0 ) {
+		auto& entry = specialization.pMapEntries[ entry_id ];
+		auto value	= (uint32_t)0;
+
+		if ( entry.size != sizeof( uint32_t ) || entry.offset + entry.size > specialization.dataSize )
+			continue;
+
+		std::memcpy( micro_ptr( value ), data + entry.offset, sizeof( uint32_t ) );
+
+		if ( entry.constantID == m_local_ids[ 0 ] )
+			local_size.width = value;
+
+		if ( entry.constantID == m_local_ids[ 1 ] )
+			local_size.height = value;
+
+		if ( entry.constantID == m_local_ids[ 2 ] )
+			local_size.depth = value;
+	}
+
+	return local_size;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+const std::vector<uint32_t>* MicroVulkanShaderReflection::GetType(
+	const MicroVulkanSpirvModule& module,
+	const uint32_t type
+) const {
+	auto iterator = module.Types.find( type );
+
+	if ( iterator == module.Types.end( ) )
+		return nullptr;
+
+	return micro_ptr( iterator->second );
+}
+
+uint32_t MicroVulkanShaderReflection::GetLocalAxis(
+	const MicroVulkanSpirvModule& module,
+	const uint32_t axis
+) const {
+	if ( !module.IsLocalSizeId )
+		return module.LocalSize[ axis ];
+
+	// Id based sizes point to constants, specialization constants resolve
+	// to their default value.
+	auto constant = module.Constants.find( module.LocalSize[ axis ] );
+
+	return ( constant != module.Constants.end( ) ) ? constant->second : 1;
+}
+
+uint32_t MicroVulkanShaderReflection::GetLocalId(
+	const MicroVulkanSpirvModule& module,
+	const uint32_t axis
+) const {
+	auto spec_id = UINT32_MAX;
+
+	// Only specialization constants carry a SpecId, literal sizes and plain
+	// constants are final.
+	if ( module.IsLocalSizeId && GetDecoration( module, module.LocalSize[ axis ], DECORATION_SPEC_ID, spec_id ) )
+		return spec_id;
+
+	return UINT32_MAX;
+}
+
+bool MicroVulkanShaderReflection::GetDecoration(
+	const MicroVulkanSpirvModule& module,
+	const uint32_t target,
+	const uint32_t decoration,
+	uint32_t& value
+) const {
+	auto iterator = module.Decorations.find( ( (uint64_t)target << 32 ) | decoration );
+
+	if ( iterator == module.Decorations.end( ) )
+		return false;
+
+	value = iterator->second;
+
+	return true;
+}
+
+bool MicroVulkanShaderReflection::GetDescriptorType(
+	const MicroVulkanSpirvModule& module,
+	const uint32_t storage,
+	const uint32_t type,
+	VkDescriptorType& descriptor_type
+) const {
+	auto* words = GetType( module, type );
+	auto block	= (uint32_t)0;
+
+	if ( words == nullptr )
+		return false;
+
+	switch ( words->at( 0 ) ) {
+		case OP_TYPE_SAMPLER		: descriptor_type = VK_DESCRIPTOR_TYPE_SAMPLER; break;
+		case OP_TYPE_SAMPLED_IMAGE	: descriptor_type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER; break;
+
+		case OP_TYPE_IMAGE :
+			if ( words->size( ) < 8 )
+				return false;
+
+			if ( words->at( 3 ) == DIM_SUBPASS_DATA )
+				descriptor_type = VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT;
+			else if ( words->at( 3 ) == DIM_BUFFER )
+				descriptor_type = ( words->at( 7 ) == 2 ) ? VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER : VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER;
+			else
+				descriptor_type = ( words->at( 7 ) == 2 ) ? VK_DESCRIPTOR_TYPE_STORAGE_IMAGE : VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+			break;
+
+		case OP_TYPE_STRUCT :
+			if ( storage == STORAGE_STORAGE_BUFFER || GetDecoration( module, type, DECORATION_BUFFER_BLOCK, block ) )
+				descriptor_type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+			else
+				descriptor_type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+			break;
+
+		default : return false;
+	}
+
+	return true;
+}
+
+uint32_t MicroVulkanShaderReflection::GetTypeSize(
+	const MicroVulkanSpirvModule& module,
+	const uint32_t type,
+	const uint32_t matrix_stride
+) const {
+	auto* words = GetType( module, type );
+	auto stride = (uint32_t)0;
+	auto size	= (uint32_t)0;
+
+	if ( words == nullptr )
+		return 0;
+
+	switch ( words->at( 0 ) ) {
+		case OP_TYPE_BOOL	 : size = 4; break;
+		case OP_TYPE_INT	 :
+		case OP_TYPE_FLOAT	 : size = words->at( 2 ) / 8; break;
+		case OP_TYPE_VECTOR	 : size = words->at( 3 ) * GetTypeSize( module, words->at( 2 ), 0 ); break;
+		case OP_TYPE_POINTER : size = 8; break;
+
+		case OP_TYPE_MATRIX :
+			stride = ( matrix_stride > 0 ) ? matrix_stride : GetTypeSize( module, words->at( 2 ), 0 );
+			size   = words->at( 3 ) * stride;
+			break;
+
+		case OP_TYPE_ARRAY : {
+			auto length = module.Constants.find( words->at( 3 ) );
+
+			if ( !GetDecoration( module, type, DECORATION_ARRAY_STRIDE, stride ) )
+				stride = GetTypeSize( module, words->at( 2 ), matrix_stride );
+
+			if ( length != module.Constants.end( ) )
+				size = length->second * stride;
+			break;
+		}
+
+		case OP_TYPE_STRUCT : {
+			auto member_id = (uint32_t)words->size( ) - 2;
+
+			while ( member_id-- > 0 ) {
+				auto member = ( (uint64_t)type << 32 ) | member_id;
+				auto offset = module.Offsets.find( member );
+				auto inner	= module.Strides.find( member );
+
+				if ( offset == module.Offsets.end( ) )
+					continue;
+
+				stride = ( inner != module.Strides.end( ) ) ? inner->second : 0;
+				size   = std::max( size, offset->second + GetTypeSize( module, words->at( member_id + 2 ), stride ) );
+			}
+			break;
+		}
+
+		default : break;
+	}
+
+	return size;
+}
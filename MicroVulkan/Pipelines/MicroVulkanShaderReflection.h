@@ -0,0 +1,173 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#pragma once
+
+#include "MicroVulkanShaderRegistry.h"
+
+micro_struct MicroVulkanSpirvModule {
+
+	std::unordered_map<uint32_t, std::vector<uint32_t>> Types;
+	std::unordered_map<uint32_t, uint32_t> Constants;
+	std::unordered_map<uint64_t, uint32_t> Decorations;
+	std::unordered_map<uint64_t, uint32_t> Offsets;
+	std::unordered_map<uint64_t, uint32_t> Strides;
+	std::vector<std::vector<uint32_t>> Variables;
+	std::vector<uint32_t> LocalSize;
+	bool IsLocalSizeId;
+
+};
+
+micro_class MicroVulkanShaderReflection final {
+
+	constexpr static uint32_t SPIRV_MAGIC			   = 0x07230203;
+	constexpr static uint32_t SPIRV_HEADER			   = 5;
+	constexpr static uint32_t OP_EXECUTION_MODE		   = 16;
+	constexpr static uint32_t OP_EXECUTION_MODE_ID	   = 331;
+	constexpr static uint32_t OP_DECORATE			   = 71;
+	constexpr static uint32_t OP_MEMBER_DECORATE	   = 72;
+	constexpr static uint32_t OP_VARIABLE			   = 59;
+	constexpr static uint32_t OP_CONSTANT			   = 43;
+	constexpr static uint32_t OP_CONSTANT_COMPOSITE	   = 44;
+	constexpr static uint32_t OP_SPEC_CONSTANT		   = 50;
+	constexpr static uint32_t OP_SPEC_CONSTANT_COMP	   = 51;
+	constexpr static uint32_t OP_TYPE_BOOL			   = 20;
+	constexpr static uint32_t OP_TYPE_INT			   = 21;
+	constexpr static uint32_t OP_TYPE_FLOAT			   = 22;
+	constexpr static uint32_t OP_TYPE_VECTOR		   = 23;
+	constexpr static uint32_t OP_TYPE_MATRIX		   = 24;
+	constexpr static uint32_t OP_TYPE_IMAGE			   = 25;
+	constexpr static uint32_t OP_TYPE_SAMPLER		   = 26;
+	constexpr static uint32_t OP_TYPE_SAMPLED_IMAGE	   = 27;
+	constexpr static uint32_t OP_TYPE_ARRAY			   = 28;
+	constexpr static uint32_t OP_TYPE_RUNTIME_ARRAY	   = 29;
+	constexpr static uint32_t OP_TYPE_STRUCT		   = 30;
+	constexpr static uint32_t OP_TYPE_POINTER		   = 32;
+	constexpr static uint32_t MODE_LOCAL_SIZE		   = 17;
+	constexpr static uint32_t MODE_LOCAL_SIZE_ID	   = 38;
+	constexpr static uint32_t DECORATION_SPEC_ID	   = 1;
+	constexpr static uint32_t DECORATION_BUFFER_BLOCK  = 3;
+	constexpr static uint32_t DECORATION_ARRAY_STRIDE  = 6;
+	constexpr static uint32_t DECORATION_MATRIX_STRIDE = 7;
+	constexpr static uint32_t DECORATION_BUILTIN	   = 11;
+	constexpr static uint32_t DECORATION_BINDING	   = 33;
+	constexpr static uint32_t DECORATION_SET		   = 34;
+	constexpr static uint32_t DECORATION_OFFSET		   = 35;
+	constexpr static uint32_t BUILTIN_WORKGROUP_SIZE   = 25;
+	constexpr static uint32_t STORAGE_UNIFORM_CONSTANT = 0;
+	constexpr static uint32_t STORAGE_UNIFORM		   = 2;
+	constexpr static uint32_t STORAGE_PUSH_CONSTANT	   = 9;
+	constexpr static uint32_t STORAGE_STORAGE_BUFFER   = 12;
+	constexpr static uint32_t DIM_BUFFER			   = 5;
+	constexpr static uint32_t DIM_SUBPASS_DATA		   = 6;
+
+private:
+	std::map<uint32_t, std::map<uint32_t, VkDescriptorSetLayoutBinding>> m_sets;
+	std::vector<VkPushConstantRange> m_push_constants;
+	VkExtent3D m_local_size;
+	std::vector<uint32_t> m_local_ids;
+
+public:
+	MicroVulkanShaderReflection( );
+
+	~MicroVulkanShaderReflection( ) = default;
+
+	bool Append( const VkShaderStageFlagBits stage, const std::vector<uint32_t>& code );
+
+	bool Acquire(
+		const MicroVulkanDevice& device,
+		MicroVulkanPipelineRegistry& registry,
+		const uint32_t first_set,
+		std::vector<VkDescriptorSetLayout>& layouts
+	) const;
+
+	void Clear( );
+
+private:
+	bool CreateModule( const std::vector<uint32_t>& code, MicroVulkanSpirvModule& module );
+
+	bool AppendBinding(
+		const VkShaderStageFlagBits stage,
+		const MicroVulkanSpirvModule& module,
+		const std::vector<uint32_t>& variable
+	);
+
+	void AppendPushConstant(
+		const VkShaderStageFlagBits stage,
+		const MicroVulkanSpirvModule& module,
+		const uint32_t type
+	);
+
+public:
+	const std::vector<VkPushConstantRange>& GetPushConstants( ) const;
+
+	uint32_t GetSetCount( ) const;
+
+	const VkExtent3D& GetLocalSize( ) const;
+
+	/**
+	 * GetLocalSize const function
+	 * @note : Workgroup axes sized by specialization constants take the
+	 *		   value the pipeline is created with.
+	 * @param specialization : Query pipeline specialization.
+	 * @return VkExtent3D
+	 **/
+	VkExtent3D GetLocalSize( const VkSpecializationInfo& specialization ) const;
+
+private:
+	const std::vector<uint32_t>* GetType( const MicroVulkanSpirvModule& module, const uint32_t type ) const;
+
+	uint32_t GetLocalAxis( const MicroVulkanSpirvModule& module, const uint32_t axis ) const;
+
+	uint32_t GetLocalId( const MicroVulkanSpirvModule& module, const uint32_t axis ) const;
+
+	bool GetDecoration(
+		const MicroVulkanSpirvModule& module,
+		const uint32_t target,
+		const uint32_t decoration,
+		uint32_t& value
+	) const;
+
+	bool GetDescriptorType(
+		const MicroVulkanSpirvModule& module,
+		const uint32_t storage,
+		const uint32_t type,
+		VkDescriptorType& descriptor_type
+	) const;
+
+	uint32_t GetTypeSize(
+		const MicroVulkanSpirvModule& module,
+		const uint32_t type,
+		const uint32_t matrix_stride
+	) const;
+
+};
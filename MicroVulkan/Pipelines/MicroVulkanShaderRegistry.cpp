@@ -0,0 +1,206 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "__micro_vulkan_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+MicroVulkanShaderRegistry::MicroVulkanShaderRegistry( )
+	: m_checksum{ },
+	m_shaders{ },
+	m_hashes{ },
+	m_hits{ 0 },
+	m_misses{ 0 },
+	m_mutex{ }
+{ }
+
+uint64_t MicroVulkanShaderRegistry::CreateHash( const std::vector<uint32_t>& code ) const {
+	auto* data	= micro_cast( code.data( ), const uint8_t* );
+	auto length = (uint64_t)code.size( ) * sizeof( uint32_t );
+
+#	ifdef MICRO_VULKAN_USE_XXHASH
+	return m_checksum.XXH3( data, length );
+#	else
+	// Both CRC run on the dispatched hardware kernels, two independent
+	// polynomials give a 64 bits key as cheap as a single pass.
+	auto crc32	= (uint64_t)m_checksum.CRC32( data, length );
+	auto crc32c = (uint64_t)m_checksum.CRC32C( data, length );
+
+	return ( crc32c << 32 ) | crc32;
+#	endif
+}
+
+bool MicroVulkanShaderRegistry::Acquire(
+	const MicroVulkanDevice& device,
+	const std::vector<uint32_t>& code,
+	VkShaderModule& module
+) {
+	auto hash = CreateHash( code );
+	auto lock = std::unique_lock{ m_mutex };
+
+	auto& entry = m_shaders[ hash ];
+
+	if ( vk::IsValid( entry.Module ) ) {
+		entry.References += 1;
+
+		module	= entry.Module;
+		m_hits += 1;
+
+		return true;
+	}
+
+	auto module_spec = CreateModuleSpec( code );
+
+	m_misses += 1;
+
+	if ( vk::CreateShader( device, module_spec, entry.Module ) != VK_SUCCESS ) {
+		if ( entry.Identifier.empty( ) )
+			m_shaders.erase( hash );
+
+		return false;
+	}
+
+	entry.References = 1;
+
+	module = entry.Module;
+
+	m_hashes.emplace( module, hash );
+
+	return true;
+}
+
+bool MicroVulkanShaderRegistry::Acquire(
+	const MicroVulkanDevice& device,
+	const std::vector<uint32_t>& code,
+	std::vector<uint8_t>& identifier
+) {
+	if ( !device.GetHasShaderModuleIdentifier( ) )
+		return false;
+
+	auto hash = CreateHash( code );
+	auto lock = std::unique_lock{ m_mutex };
+
+	auto& entry = m_shaders[ hash ];
+
+	// Identifiers are kept after their module is released, a later pipeline
+	// can still be looked up in the cache without any SPIR-V.
+	if ( entry.Identifier.empty( ) ) {
+		auto module_spec = CreateModuleSpec( code );
+
+		if ( !vk::GetShaderModuleIdentifier( device, module_spec, entry.Identifier ) ) {
+			if ( !vk::IsValid( entry.Module ) )
+				m_shaders.erase( hash );
+
+			return false;
+		}
+	}
+
+	identifier = entry.Identifier;
+
+	return true;
+}
+
+void MicroVulkanShaderRegistry::Release(
+	const MicroVulkanDevice& device,
+	VkShaderModule& module
+) {
+	auto lock = std::unique_lock{ m_mutex };
+
+	auto hash = m_hashes.find( module );
+
+	if ( hash == m_hashes.end( ) ) {
+		vk::DestroyShader( device, module );
+
+		return;
+	}
+
+	auto& entry = m_shaders[ hash->second ];
+
+	if ( --entry.References == 0 ) {
+		vk::DestroyShader( device, entry.Module );
+
+		if ( entry.Identifier.empty( ) )
+			m_shaders.erase( hash->second );
+
+		m_hashes.erase( hash );
+	}
+
+	module = VK_NULL_HANDLE;
+}
+
+void MicroVulkanShaderRegistry::Destroy( const MicroVulkanDevice& device ) {
+	auto lock = std::unique_lock{ m_mutex };
+
+	for ( auto& [ hash, entry ] : m_shaders )
+		vk::DestroyShader( device, entry.Module );
+
+	m_shaders.clear( );
+	m_hashes.clear( );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+VkShaderModuleCreateInfo MicroVulkanShaderRegistry::CreateModuleSpec(
+	const std::vector<uint32_t>& code
+) {
+	auto module_spec = VkShaderModuleCreateInfo{ };
+
+	module_spec.sType	 = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+	module_spec.pNext	 = VK_NULL_HANDLE;
+	module_spec.flags	 = VK_UNUSED_FLAG;
+	module_spec.codeSize = code.size( ) * sizeof( uint32_t );
+	module_spec.pCode	 = code.data( );
+
+	return module_spec;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t MicroVulkanShaderRegistry::GetHitCount( ) const {
+	auto lock = std::unique_lock{ m_mutex };
+
+	return m_hits;
+}
+
+uint32_t MicroVulkanShaderRegistry::GetMissCount( ) const {
+	auto lock = std::unique_lock{ m_mutex };
+
+	return m_misses;
+}
+
+uint32_t MicroVulkanShaderRegistry::GetModuleCount( ) const {
+	auto lock = std::unique_lock{ m_mutex };
+
+	return (uint32_t)m_hashes.size( );
+}
@@ -0,0 +1,87 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "MicroVulkanPipelineRegistry.h"
+
+micro_struct MicroVulkanShaderEntry {
+
+	VkShaderModule Module;
+	std::vector<uint8_t> Identifier;
+	uint32_t References;
+
+};
+
+micro_class MicroVulkanShaderRegistry final {
+
+private:
+	MicroVulkanChecksum m_checksum;
+	std::unordered_map<uint64_t, MicroVulkanShaderEntry> m_shaders;
+	std::unordered_map<VkShaderModule, uint64_t> m_hashes;
+	uint32_t m_hits;
+	uint32_t m_misses;
+	mutable std::mutex m_mutex;
+
+public:
+	MicroVulkanShaderRegistry( );
+
+	~MicroVulkanShaderRegistry( ) = default;
+
+	uint64_t CreateHash( const std::vector<uint32_t>& code ) const;
+
+	bool Acquire(
+		const MicroVulkanDevice& device,
+		const std::vector<uint32_t>& code,
+		VkShaderModule& module
+	);
+
+	bool Acquire(
+		const MicroVulkanDevice& device,
+		const std::vector<uint32_t>& code,
+		std::vector<uint8_t>& identifier
+	);
+
+	void Release( const MicroVulkanDevice& device, VkShaderModule& module );
+
+	void Destroy( const MicroVulkanDevice& device );
+
+private:
+	VkShaderModuleCreateInfo CreateModuleSpec( const std::vector<uint32_t>& code );
+
+public:
+	uint32_t GetHitCount( ) const;
+
+	uint32_t GetMissCount( ) const;
+
+	uint32_t GetModuleCount( ) const;
+
+};
@@ -36,7 +36,8 @@
 ////////////////////////////////////////////////////////////////////////////////////////////
 MicroVulkanQueues::MicroVulkanQueues( )
 	: m_queues{ },
-	m_queue_families{ }
+	m_queue_families{ },
+	m_upload{ }
 { }
 
 void MicroVulkanQueues::Create( const MicroVulkanDevice& device ) {
@@ -53,6 +54,19 @@ void MicroVulkanQueues::Create( const MicroVulkanDevice& device ) {
 
 		queue_idx = (vk::QueueTypes)( queue_idx + 1 );
 	}
+
+	auto& graphics = m_queues[ vk::QUEUE_TYPE_GRAPHICS ];
+
+	if ( graphics.empty( ) )
+		return;
+
+	// The reserved queue stays in use so Acquire never hands it to a frame.
+	m_upload.Type	 = vk::QUEUE_TYPE_GRAPHICS;
+	m_upload.QueueID = (uint32_t)graphics.size( ) - 1;
+	m_upload.Queue	 = graphics.back( ).Queue;
+
+	if ( graphics.size( ) > 1 )
+		graphics.back( ).InUse = VK_TRUE;
 }
 
 MicroVulkanQueueHandle MicroVulkanQueues::Acquire( vk::QueueTypes type ) {
@@ -88,7 +102,12 @@ void MicroVulkanQueues::Release( MicroVulkanQueueHandle& handle ) {
 	}
 }
 
+MicroVulkanQueueHandle MicroVulkanQueues::AcquireUpload( ) const {
+	return m_upload;
+}
+
 void MicroVulkanQueues::Destroy( ) {
+	m_upload = { };
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////
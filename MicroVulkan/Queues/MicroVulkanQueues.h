@@ -40,6 +40,7 @@ micro_class MicroVulkanQueues final {
 private:
 	mutable std::map<vk::QueueTypes, QueueList> m_queues;
 	mutable std::map<vk::QueueTypes, uint32_t> m_queue_families;
+	MicroVulkanQueueHandle m_upload;
 
 public:
 	MicroVulkanQueues( );
@@ -52,6 +53,15 @@ public:
 
 	void Release( MicroVulkanQueueHandle& handle );
 
+	/**
+	 * AcquireUpload const function
+	 * @note : The last graphics queue is reserved for uploads when there's
+	 *		   more than one, otherwise uploads share the first queue with
+	 *		   the frames and must be submitted from the render thread.
+	 * @return MicroVulkanQueueHandle
+	 **/
+	MicroVulkanQueueHandle AcquireUpload( ) const;
+
 	void Destroy( );
 
 private:
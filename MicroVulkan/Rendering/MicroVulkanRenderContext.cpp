@@ -99,6 +99,17 @@ bool MicroVulkanRenderContext::CmdBeginRenderPass(
 	return state;
 }
 
+bool MicroVulkanRenderContext::CmdBeginRendering( const VkRenderingInfo& rendering_info ) {
+	// Shader object materials have no render pass, they are recorded inside
+	// a dynamic rendering instance instead.
+	const auto state = rendering_info.colorAttachmentCount > 0 || rendering_info.pDepthAttachment != nullptr;
+
+	if ( state && CommandBuffer.GetIsValid( ) )
+		vk::CmdBeginRendering( CommandBuffer, rendering_info );
+
+	return state;
+}
+
 void MicroVulkanRenderContext::CmdSetViewport( const VkViewport& viewport ) {
 	vk::CmdSetViewport( CommandBuffer.Buffer, viewport );
 }
@@ -161,6 +172,11 @@ void MicroVulkanRenderContext::CmdEndRenderPass( ) {
 		vkCmdEndRenderPass( CommandBuffer );
 }
 
+void MicroVulkanRenderContext::CmdEndRendering( ) {
+	if ( CommandBuffer.GetIsValid( ) )
+		vk::CmdEndRendering( CommandBuffer );
+}
+
 void MicroVulkanRenderContext::CmdEndRecord( ) {
 	if ( CommandBuffer.GetIsValid( ) )
 		vkEndCommandBuffer( CommandBuffer );
@@ -31,7 +31,7 @@
 
 #pragma once
 
-#include "../Pipelines/MicroVulkanPipelines.h"
+#include "../Ressources/Descriptors/MicroVulkanBindless.h"
 
 micro_struct MicroVulkanRenderContext {
 
@@ -63,6 +63,8 @@ micro_struct MicroVulkanRenderContext {
 		const VkSubpassContents command_policy
 	);
 
+	bool CmdBeginRendering( const VkRenderingInfo& rendering_info );
+
 	void CmdSetViewport( const VkViewport& viewport );
 
 	void CmdSetViewports( std::initializer_list<VkViewport> viewports );
@@ -83,6 +85,8 @@ micro_struct MicroVulkanRenderContext {
 
 	void CmdEndRenderPass( );
 
+	void CmdEndRendering( );
+
 	void CmdNextSubpass( );
 
 	void CmdExecute( const std::vector<VkCommandBuffer>& secondary_commands );
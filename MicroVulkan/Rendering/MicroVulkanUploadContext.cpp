@@ -0,0 +1,80 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "__micro_vulkan_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+MicroVulkanUploadContext::MicroVulkanUploadContext( )
+	: Signal{ VK_NULL_HANDLE },
+	Queue{ },
+	CommandBuffer{ },
+	Stagings{ }
+{ }
+
+VkResult MicroVulkanUploadContext::CmdBeginRecord( ) {
+	auto result = VK_ERROR_UNKNOWN;
+
+	if ( CommandBuffer.GetIsValid( ) ) {
+		auto specification = VkCommandBufferBeginInfo{ };
+
+		specification.sType			   = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+		specification.pNext			   = VK_NULL_HANDLE;
+		specification.flags			   = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+		specification.pInheritanceInfo = VK_NULL_HANDLE;
+
+		vkResetCommandBuffer( CommandBuffer, VK_UNUSED_FLAG );
+
+		result = vkBeginCommandBuffer( CommandBuffer, micro_ptr( specification ) );
+	}
+
+	return result;
+}
+
+void MicroVulkanUploadContext::CmdEndRecord( ) {
+	if ( CommandBuffer.GetIsValid( ) )
+		vkEndCommandBuffer( CommandBuffer );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool MicroVulkanUploadContext::GetIsValid( ) const {
+	return vk::IsValid( Signal ) && Queue.GetIsValid( ) && CommandBuffer.GetIsValid( );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	OPERATOR ===
+////////////////////////////////////////////////////////////////////////////////////////////
+MicroVulkanUploadContext::operator bool ( ) const {
+	return GetIsValid( );
+}
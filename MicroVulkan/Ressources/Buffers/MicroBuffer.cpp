@@ -0,0 +1,108 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#include "__micro_vulkan_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+MicroBuffer::MicroBuffer( )
+	: m_buffer{ },
+	m_capacity{ 0 },
+	m_index{ UINT32_MAX }
+{ }
+
+bool MicroBuffer::Create(
+	MicroVulkan& vulkan,
+	const MicroVulkanBufferSpecification& specification
+) {
+	auto& device   = vulkan.GetDevice( );
+	auto& queues   = vulkan.GetQueues( );
+	auto& bindless = vulkan.GetBindless( );
+
+	if ( !m_buffer.Create( device, queues, specification ) )
+		return false;
+
+	m_capacity = specification.Capacity;
+
+	// Storage buffers get a stable slot in the bindless set, shaders reach
+	// them through the index instead of a per-draw descriptor set.
+	if ( bindless.GetIsValid( ) && ( specification.Usage & VK_BUFFER_USAGE_STORAGE_BUFFER_BIT ) )
+		bindless.Acquire( device, m_buffer.Get( ), 0, VK_WHOLE_SIZE, m_index );
+
+	return true;
+}
+
+VkResult MicroBuffer::Map( MicroVulkan& vulkan, void*& mapping ) {
+	auto& device = vulkan.GetDevice( );
+
+	return m_buffer.Map( device, mapping );
+}
+
+void MicroBuffer::Unmap( MicroVulkan& vulkan ) {
+	auto& device = vulkan.GetDevice( );
+
+	m_buffer.Unmap( device );
+}
+
+void MicroBuffer::Destroy( MicroVulkan& vulkan ) {
+	auto& device   = vulkan.GetDevice( );
+	auto& bindless = vulkan.GetBindless( );
+
+	bindless.Release( VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, m_index );
+
+	m_buffer.Destroy( device );
+
+	m_capacity = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+const MicroVulkanBuffer& MicroBuffer::Get( ) const {
+	return m_buffer;
+}
+
+VkDeviceSize MicroBuffer::GetCapacity( ) const {
+	return m_capacity;
+}
+
+uint32_t MicroBuffer::GetIndex( ) const {
+	return m_index;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	OPERATOR ===
+////////////////////////////////////////////////////////////////////////////////////////////
+MicroBuffer::operator const MicroVulkanBuffer& ( ) const {
+	return Get( );
+}
@@ -0,0 +1,70 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#pragma once
+
+#include "../../MicroVulkan.h"
+
+micro_class MicroBuffer {
+
+private:
+	MicroVulkanBuffer m_buffer;
+	VkDeviceSize m_capacity;
+	uint32_t m_index;
+
+public:
+	MicroBuffer( );
+
+	virtual ~MicroBuffer( ) = default;
+
+	bool Create(
+		MicroVulkan& vulkan,
+		const MicroVulkanBufferSpecification& specification
+	);
+
+	VkResult Map( MicroVulkan& vulkan, void*& mapping );
+
+	void Unmap( MicroVulkan& vulkan );
+
+	void Destroy( MicroVulkan& vulkan );
+
+public:
+	const MicroVulkanBuffer& Get( ) const;
+
+	VkDeviceSize GetCapacity( ) const;
+
+	uint32_t GetIndex( ) const;
+
+public:
+	operator const MicroVulkanBuffer& ( ) const;
+
+};
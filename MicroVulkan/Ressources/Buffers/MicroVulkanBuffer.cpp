@@ -77,6 +77,20 @@ bool MicroVulkanBuffer::CreateStorage(
 			vkBindBufferMemory( device, m_buffer, m_memory, 0 ) == VK_SUCCESS;
 }
 
+VkResult MicroVulkanBuffer::Map( const MicroVulkanDevice& device, void*& mapping ) {
+	auto result = VK_ERROR_MEMORY_MAP_FAILED;
+
+	if ( vk::IsValid( m_memory ) )
+		result = vkMapMemory( device, m_memory, 0, VK_WHOLE_SIZE, VK_UNUSED_FLAG, micro_ptr( mapping ) );
+
+	return result;
+}
+
+void MicroVulkanBuffer::Unmap( const MicroVulkanDevice& device ) {
+	if ( vk::IsValid( m_memory ) )
+		vkUnmapMemory( device, m_memory );
+}
+
 void MicroVulkanBuffer::Destroy( const MicroVulkanDevice& device ) {
 	vk::DeallocateMemory( device, m_memory );
 	vk::DestroyBuffer( device, m_buffer );
@@ -50,6 +50,10 @@ public:
 		const MicroVulkanBufferSpecification& specification
 	);
 
+	VkResult Map( const MicroVulkanDevice& device, void*& mapping );
+
+	void Unmap( const MicroVulkanDevice& device );
+
 	void Destroy( const MicroVulkanDevice& device );
 
 private:
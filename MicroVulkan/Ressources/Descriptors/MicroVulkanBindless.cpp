@@ -0,0 +1,370 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#include "__micro_vulkan_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+MicroVulkanBindless::MicroVulkanBindless( )
+	: m_frame_count{ 0 },
+	m_layout{ VK_NULL_HANDLE },
+	m_pool{ VK_NULL_HANDLE },
+	m_set{ VK_NULL_HANDLE },
+	m_tables{ },
+	m_mutex{ }
+{ }
+
+bool MicroVulkanBindless::Create(
+	const MicroVulkanDevice& device,
+	const MicroVulkanPipelines& pipelines,
+	const uint32_t frame_count
+) {
+	// Bindless is optional, without descriptor indexing materials keep
+	// their own sets and the renderer still starts.
+	if ( !device.GetHasDescriptorIndexing( ) )
+		return true;
+
+	m_frame_count = frame_count;
+	m_tables	  = {
+		{ VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE , MAX_SAMPLED_IMAGES	, 0, { }, { } },
+		{ VK_DESCRIPTOR_TYPE_SAMPLER	   , MAX_SAMPLERS		, 0, { }, { } },
+		{ VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, MAX_STORAGE_BUFFERS, 0, { }, { } }
+	};
+
+	auto& limits   = device.GetDescriptorIndexingLimits( );
+	auto resources = limits.maxPerStageUpdateAfterBindResources;
+
+	// The pool and layout are update after bind and visible to every stage,
+	// both the set and per stage update after bind limits apply. Samplers
+	// don't count as stage resources.
+	for ( auto& table : m_tables ) {
+		auto limit = pipelines.GetLimit( table.Type );
+
+		if ( limit > 0 )
+			table.Capacity = std::min( table.Capacity, limit );
+
+		switch ( table.Type ) {
+			case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE :
+				table.Capacity = std::min( { table.Capacity, limits.maxDescriptorSetUpdateAfterBindSampledImages, limits.maxPerStageDescriptorUpdateAfterBindSampledImages, resources } );
+				resources	  -= table.Capacity;
+				break;
+
+			case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER :
+				table.Capacity = std::min( { table.Capacity, limits.maxDescriptorSetUpdateAfterBindStorageBuffers, limits.maxPerStageDescriptorUpdateAfterBindStorageBuffers, resources } );
+				resources	  -= table.Capacity;
+				break;
+
+			case VK_DESCRIPTOR_TYPE_SAMPLER :
+				table.Capacity = std::min( { table.Capacity, limits.maxDescriptorSetUpdateAfterBindSamplers, limits.maxPerStageDescriptorUpdateAfterBindSamplers } );
+				break;
+
+			default : break;
+		}
+	}
+
+	return CreateLayout( device ) && CreatePool( device );
+}
+
+bool MicroVulkanBindless::Acquire(
+	const MicroVulkanDevice& device,
+	const VkImageView& view,
+	const VkImageLayout layout,
+	uint32_t& index
+) {
+	auto lock		= std::unique_lock{ m_mutex };
+	auto image_info = VkDescriptorImageInfo{ };
+
+	if ( !vk::IsValid( view ) || !AcquireIndex( VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, index ) )
+		return false;
+
+	image_info.sampler	   = VK_NULL_HANDLE;
+	image_info.imageView   = view;
+	image_info.imageLayout = layout;
+
+	Write( device, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, index, micro_ptr( image_info ), VK_NULL_HANDLE );
+
+	return true;
+}
+
+bool MicroVulkanBindless::Acquire(
+	const MicroVulkanDevice& device,
+	const VkSampler& sampler,
+	uint32_t& index
+) {
+	auto lock		= std::unique_lock{ m_mutex };
+	auto image_info = VkDescriptorImageInfo{ };
+
+	if ( !vk::IsValid( sampler ) || !AcquireIndex( VK_DESCRIPTOR_TYPE_SAMPLER, index ) )
+		return false;
+
+	image_info.sampler	   = sampler;
+	image_info.imageView   = VK_NULL_HANDLE;
+	image_info.imageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+	Write( device, VK_DESCRIPTOR_TYPE_SAMPLER, index, micro_ptr( image_info ), VK_NULL_HANDLE );
+
+	return true;
+}
+
+bool MicroVulkanBindless::Acquire(
+	const MicroVulkanDevice& device,
+	const VkBuffer& buffer,
+	const VkDeviceSize offset,
+	const VkDeviceSize range,
+	uint32_t& index
+) {
+	auto lock		 = std::unique_lock{ m_mutex };
+	auto buffer_info = VkDescriptorBufferInfo{ };
+
+	if ( !vk::IsValid( buffer ) || !AcquireIndex( VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, index ) )
+		return false;
+
+	buffer_info.buffer = buffer;
+	buffer_info.offset = offset;
+	buffer_info.range  = range;
+
+	Write( device, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, index, VK_NULL_HANDLE, micro_ptr( buffer_info ) );
+
+	return true;
+}
+
+void MicroVulkanBindless::Release( const VkDescriptorType type, uint32_t& index ) {
+	auto lock	= std::unique_lock{ m_mutex };
+	auto* table = GetTable( type );
+
+	if ( table == nullptr || index >= table->Count )
+		return;
+
+	// Frames in flight may still read the slot, it only goes back to the
+	// free list once every one of them has been waited on.
+	table->Pending.emplace_back( index, m_frame_count );
+
+	index = UINT32_MAX;
+}
+
+void MicroVulkanBindless::Reset( ) {
+	auto lock = std::unique_lock{ m_mutex };
+
+	for ( auto& table : m_tables ) {
+		auto pending_id = table.Pending.size( );
+
+		while ( pending_id-- > 0 ) {
+			auto& pending = table.Pending[ pending_id ];
+
+			if ( pending.second > 0 && --pending.second > 0 )
+				continue;
+
+			table.Free.emplace_back( pending.first );
+
+			pending = table.Pending.back( );
+
+			table.Pending.pop_back( );
+		}
+	}
+}
+
+void MicroVulkanBindless::Destroy( const MicroVulkanDevice& device ) {
+	auto lock = std::unique_lock{ m_mutex };
+
+	vk::DestroyDescriptorPool( device, m_pool );
+	vk::DestroyDescriptorSetLayout( device, m_layout );
+
+	m_set = VK_NULL_HANDLE;
+
+	m_tables.clear( );
+}
+
+void MicroVulkanBindless::CmdBind(
+	const VkCommandBuffer& commands,
+	const VkPipelineBindPoint bind_point,
+	const VkPipelineLayout& layout
+) {
+	auto descriptors = std::vector<VkDescriptorSet>{ m_set };
+
+	// Set 0 survives pipeline changes as long as the layouts share it and
+	// their push constant ranges, it is bound once per command buffer.
+	if ( vk::IsValid( m_set ) )
+		vk::CmdBindDescriptorSets( commands, bind_point, layout, 0, descriptors );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool MicroVulkanBindless::CreateLayout( const MicroVulkanDevice& device ) {
+	auto bindings	   = std::vector<VkDescriptorSetLayoutBinding>( m_tables.size( ) );
+	auto binding_flags = std::vector<VkDescriptorBindingFlags>( m_tables.size( ) );
+	auto flags_spec	   = VkDescriptorSetLayoutBindingFlagsCreateInfo{ };
+	auto layout_spec   = VkDescriptorSetLayoutCreateInfo{ };
+	auto binding_id	   = (uint32_t)m_tables.size( );
+
+	while ( binding_id-- > 0 ) {
+		auto& binding = bindings[ binding_id ];
+
+		binding.binding			   = binding_id;
+		binding.descriptorType	   = m_tables[ binding_id ].Type;
+		binding.descriptorCount	   = m_tables[ binding_id ].Capacity;
+		binding.stageFlags		   = VK_SHADER_STAGE_ALL;
+		binding.pImmutableSamplers = VK_NULL_HANDLE;
+
+		binding_flags[ binding_id ] = VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT;
+	}
+
+	flags_spec.sType		 = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+	flags_spec.pNext		 = VK_NULL_HANDLE;
+	flags_spec.bindingCount	 = (uint32_t)binding_flags.size( );
+	flags_spec.pBindingFlags = binding_flags.data( );
+
+	layout_spec.sType		 = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+	layout_spec.pNext		 = micro_ptr( flags_spec );
+	layout_spec.flags		 = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
+	layout_spec.bindingCount = (uint32_t)bindings.size( );
+	layout_spec.pBindings	 = bindings.data( );
+
+	return vk::CreateDescriptorSetLayout( device, layout_spec, m_layout ) == VK_SUCCESS;
+}
+
+bool MicroVulkanBindless::CreatePool( const MicroVulkanDevice& device ) {
+	auto pool_sizes		 = std::vector<VkDescriptorPoolSize>{ };
+	auto pool_spec		 = VkDescriptorPoolCreateInfo{ };
+	auto descriptor_spec = VkDescriptorSetAllocateInfo{ };
+	auto descriptors	 = std::vector<VkDescriptorSet>{ };
+
+	pool_sizes.reserve( m_tables.size( ) );
+
+	for ( auto& table : m_tables )
+		pool_sizes.emplace_back( VkDescriptorPoolSize{ table.Type, table.Capacity } );
+
+	pool_spec.sType			= VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+	pool_spec.pNext			= VK_NULL_HANDLE;
+	pool_spec.flags			= VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT;
+	pool_spec.maxSets		= 1;
+	pool_spec.poolSizeCount = (uint32_t)pool_sizes.size( );
+	pool_spec.pPoolSizes	= pool_sizes.data( );
+
+	if ( vk::CreateDescriptorPool( device, pool_spec, m_pool ) != VK_SUCCESS )
+		return false;
+
+	descriptor_spec.sType			   = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+	descriptor_spec.pNext			   = VK_NULL_HANDLE;
+	descriptor_spec.descriptorPool	   = m_pool;
+	descriptor_spec.descriptorSetCount = 1;
+	descriptor_spec.pSetLayouts		   = micro_ptr( m_layout );
+
+	if ( vk::AllocateDescriptors( device, descriptor_spec, descriptors ) != VK_SUCCESS )
+		return false;
+
+	m_set = descriptors[ 0 ];
+
+	return true;
+}
+
+bool MicroVulkanBindless::AcquireIndex( const VkDescriptorType type, uint32_t& index ) {
+	auto* table = GetTable( type );
+
+	if ( table == nullptr || !vk::IsValid( m_set ) )
+		return false;
+
+	if ( !table->Free.empty( ) ) {
+		index = table->Free.back( );
+
+		table->Free.pop_back( );
+	} else if ( table->Count < table->Capacity )
+		index = table->Count++;
+	else
+		return false;
+
+	return true;
+}
+
+void MicroVulkanBindless::Write(
+	const MicroVulkanDevice& device,
+	const VkDescriptorType type,
+	const uint32_t index,
+	const VkDescriptorImageInfo* image,
+	const VkDescriptorBufferInfo* buffer
+) {
+	auto writes = std::vector<VkWriteDescriptorSet>( 1 );
+	auto copies = std::vector<VkCopyDescriptorSet>{ };
+	auto& write = writes[ 0 ];
+
+	write.sType			   = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+	write.pNext			   = VK_NULL_HANDLE;
+	write.dstSet		   = m_set;
+	write.dstBinding	   = (uint32_t)( GetTable( type ) - m_tables.data( ) );
+	write.dstArrayElement  = index;
+	write.descriptorCount  = 1;
+	write.descriptorType   = type;
+	write.pImageInfo	   = image;
+	write.pBufferInfo	   = buffer;
+	write.pTexelBufferView = VK_NULL_HANDLE;
+
+	vk::UpdateDescriptorSets( device, writes, copies );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool MicroVulkanBindless::GetIsValid( ) const {
+	return vk::IsValid( m_set );
+}
+
+VkDescriptorSetLayout MicroVulkanBindless::GetLayout( ) const {
+	return m_layout;
+}
+
+VkDescriptorSet MicroVulkanBindless::GetSet( ) const {
+	return m_set;
+}
+
+uint32_t MicroVulkanBindless::GetCount( const VkDescriptorType type ) const {
+	auto lock = std::unique_lock{ m_mutex };
+
+	for ( auto& table : m_tables ) {
+		if ( table.Type == type )
+			return table.Count - (uint32_t)( table.Free.size( ) + table.Pending.size( ) );
+	}
+
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+MicroVulkanBindlessTable* MicroVulkanBindless::GetTable( const VkDescriptorType type ) {
+	for ( auto& table : m_tables ) {
+		if ( table.Type == type )
+			return micro_ptr( table );
+	}
+
+	return nullptr;
+}
@@ -0,0 +1,134 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#pragma once
+
+#include "MicroVulkanDescriptorAllocator.h"
+
+micro_struct MicroVulkanBindlessTable {
+
+	VkDescriptorType Type;
+	uint32_t Capacity;
+	uint32_t Count;
+	std::vector<uint32_t> Free;
+	std::vector<std::pair<uint32_t, uint32_t>> Pending;
+
+};
+
+micro_class MicroVulkanBindless final {
+
+	constexpr static uint32_t MAX_SAMPLED_IMAGES  = 16384;
+	constexpr static uint32_t MAX_SAMPLERS		  = 1024;
+	constexpr static uint32_t MAX_STORAGE_BUFFERS = 16384;
+
+private:
+	uint32_t m_frame_count;
+	VkDescriptorSetLayout m_layout;
+	VkDescriptorPool m_pool;
+	VkDescriptorSet m_set;
+	std::vector<MicroVulkanBindlessTable> m_tables;
+	mutable std::mutex m_mutex;
+
+public:
+	MicroVulkanBindless( );
+
+	MicroVulkanBindless( const MicroVulkanBindless& ) = delete;
+
+	~MicroVulkanBindless( ) = default;
+
+	bool Create(
+		const MicroVulkanDevice& device,
+		const MicroVulkanPipelines& pipelines,
+		const uint32_t frame_count
+	);
+
+	bool Acquire(
+		const MicroVulkanDevice& device,
+		const VkImageView& view,
+		const VkImageLayout layout,
+		uint32_t& index
+	);
+
+	bool Acquire(
+		const MicroVulkanDevice& device,
+		const VkSampler& sampler,
+		uint32_t& index
+	);
+
+	bool Acquire(
+		const MicroVulkanDevice& device,
+		const VkBuffer& buffer,
+		const VkDeviceSize offset,
+		const VkDeviceSize range,
+		uint32_t& index
+	);
+
+	void Release( const VkDescriptorType type, uint32_t& index );
+
+	void Reset( );
+
+	void Destroy( const MicroVulkanDevice& device );
+
+	void CmdBind(
+		const VkCommandBuffer& commands,
+		const VkPipelineBindPoint bind_point,
+		const VkPipelineLayout& layout
+	);
+
+private:
+	bool CreateLayout( const MicroVulkanDevice& device );
+
+	bool CreatePool( const MicroVulkanDevice& device );
+
+	bool AcquireIndex( const VkDescriptorType type, uint32_t& index );
+
+	void Write(
+		const MicroVulkanDevice& device,
+		const VkDescriptorType type,
+		const uint32_t index,
+		const VkDescriptorImageInfo* image,
+		const VkDescriptorBufferInfo* buffer
+	);
+
+public:
+	bool GetIsValid( ) const;
+
+	VkDescriptorSetLayout GetLayout( ) const;
+
+	VkDescriptorSet GetSet( ) const;
+
+	uint32_t GetCount( const VkDescriptorType type ) const;
+
+private:
+	MicroVulkanBindlessTable* GetTable( const VkDescriptorType type );
+
+};
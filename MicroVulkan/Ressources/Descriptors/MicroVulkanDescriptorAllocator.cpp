@@ -0,0 +1,331 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "__micro_vulkan_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+MicroVulkanDescriptorAllocator::MicroVulkanDescriptorAllocator( )
+	: m_ratios{ },
+	m_limits{ },
+	m_set_count{ POOL_SETS },
+	m_pools{ },
+	m_free_pools{ },
+	m_frame_pools{ },
+	m_sets{ },
+	m_mutex{ }
+{ }
+
+bool MicroVulkanDescriptorAllocator::Create(
+	const MicroVulkanPipelines& pipelines,
+	const uint32_t frame_count
+) {
+	// Average descriptor count per set, scaled by the pool set count and
+	// clamped to the device limits when a pool is created.
+	m_ratios = {
+		{ VK_DESCRIPTOR_TYPE_SAMPLER				, 1 },
+		{ VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER , 4 },
+		{ VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE			, 4 },
+		{ VK_DESCRIPTOR_TYPE_STORAGE_IMAGE			, 1 },
+		{ VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER	, 1 },
+		{ VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER	, 1 },
+		{ VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER			, 2 },
+		{ VK_DESCRIPTOR_TYPE_STORAGE_BUFFER			, 2 },
+		{ VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC , 1 },
+		{ VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC , 1 },
+		{ VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT		, 1 }
+	};
+
+	m_limits = pipelines.GetLimits( );
+
+	m_frame_pools.resize( frame_count );
+
+	return frame_count > 0;
+}
+
+VkResult MicroVulkanDescriptorAllocator::Allocate(
+	const MicroVulkanDevice& device,
+	const VkDescriptorSetLayout& layout,
+	VkDescriptorSet& descriptor
+) {
+	auto lock	= std::unique_lock{ m_mutex };
+	auto pool	= VkDescriptorPool{ VK_NULL_HANDLE };
+	auto result = AllocateFrom( device, VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT, layout, m_pools, descriptor, pool );
+
+	if ( result == VK_SUCCESS )
+		m_sets.emplace( descriptor, pool );
+
+	return result;
+}
+
+VkResult MicroVulkanDescriptorAllocator::Allocate(
+	const MicroVulkanDevice& device,
+	const uint32_t frame_id,
+	const VkDescriptorSetLayout& layout,
+	VkDescriptorSet& descriptor
+) {
+	micro_assert( frame_id < (uint32_t)m_frame_pools.size( ), "Frame id must be lower than the swapchain image count" );
+
+	auto lock = std::unique_lock{ m_mutex };
+	auto pool = VkDescriptorPool{ VK_NULL_HANDLE };
+
+	return AllocateFrom( device, VK_UNUSED_FLAG, layout, m_frame_pools[ frame_id ], descriptor, pool );
+}
+
+VkResult MicroVulkanDescriptorAllocator::Allocate(
+	const MicroVulkanDevice& device,
+	const std::vector<VkDescriptorSetLayout>& layouts,
+	std::vector<VkDescriptorSet>& descriptors
+) {
+	descriptors.resize( layouts.size( ), VK_NULL_HANDLE );
+
+	for ( auto layout_id = (size_t)0; layout_id < layouts.size( ); layout_id++ ) {
+		auto result = Allocate( device, layouts[ layout_id ], descriptors[ layout_id ] );
+
+		if ( result != VK_SUCCESS )
+			return result;
+	}
+
+	return VK_SUCCESS;
+}
+
+void MicroVulkanDescriptorAllocator::Release(
+	const MicroVulkanDevice& device,
+	VkDescriptorSet& descriptor
+) {
+	auto lock = std::unique_lock{ m_mutex };
+
+	auto pool = m_sets.find( descriptor );
+
+	if ( pool == m_sets.end( ) )
+		return;
+
+	auto descriptors = std::vector<VkDescriptorSet>{ descriptor };
+
+	vk::DeallocateDescriptors( device, pool->second, descriptors );
+
+	m_sets.erase( pool );
+
+	descriptor = VK_NULL_HANDLE;
+}
+
+void MicroVulkanDescriptorAllocator::Reset(
+	const MicroVulkanDevice& device,
+	const uint32_t frame_id
+) {
+	auto lock = std::unique_lock{ m_mutex };
+
+	if ( frame_id >= (uint32_t)m_frame_pools.size( ) )
+		return;
+
+	// Transient sets die in bulk, the pools go back to the free list so the
+	// next frame reuses them instead of creating new ones.
+	for ( auto& pool : m_frame_pools[ frame_id ] ) {
+		vk::ResetDescriptorPool( device, pool );
+
+		m_free_pools.emplace_back( pool );
+	}
+
+	m_frame_pools[ frame_id ].clear( );
+}
+
+void MicroVulkanDescriptorAllocator::Destroy( const MicroVulkanDevice& device ) {
+	auto lock = std::unique_lock{ m_mutex };
+
+	for ( auto& pool : m_pools )
+		vk::DestroyDescriptorPool( device, pool );
+
+	for ( auto& pool : m_free_pools )
+		vk::DestroyDescriptorPool( device, pool );
+
+	for ( auto& pools : m_frame_pools ) {
+		for ( auto& pool : pools )
+			vk::DestroyDescriptorPool( device, pool );
+	}
+
+	m_pools.clear( );
+	m_free_pools.clear( );
+	m_frame_pools.clear( );
+	m_sets.clear( );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+std::vector<VkDescriptorPoolSize> MicroVulkanDescriptorAllocator::CreatePoolSizes(
+	const uint32_t set_count
+) {
+	auto pool_sizes = std::vector<VkDescriptorPoolSize>{ };
+
+	pool_sizes.reserve( m_ratios.size( ) );
+
+	for ( auto& ratio : m_ratios ) {
+		auto count = ratio.descriptorCount * set_count;
+		auto limit = m_limits.find( ratio.type );
+
+		if ( limit != m_limits.end( ) && limit->second > 0 )
+			count = std::min( count, limit->second );
+
+		pool_sizes.emplace_back( VkDescriptorPoolSize{ ratio.type, count } );
+	}
+
+	return pool_sizes;
+}
+
+VkResult MicroVulkanDescriptorAllocator::CreatePool(
+	const MicroVulkanDevice& device,
+	const VkDescriptorPoolCreateFlags flags,
+	VkDescriptorPool& pool
+) {
+	auto pool_sizes = CreatePoolSizes( m_set_count );
+	auto pool_spec	= VkDescriptorPoolCreateInfo{ };
+
+	pool_spec.sType			= VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+	pool_spec.pNext			= VK_NULL_HANDLE;
+	pool_spec.flags			= flags;
+	pool_spec.maxSets		= m_set_count;
+	pool_spec.poolSizeCount = (uint32_t)pool_sizes.size( );
+	pool_spec.pPoolSizes	= pool_sizes.data( );
+
+	// Every new pool doubles the previous one, scenes with many materials
+	// end up with a handful of large pools.
+	m_set_count = std::min( m_set_count * 2, POOL_MAX_SETS );
+
+	return vk::CreateDescriptorPool( device, pool_spec, pool );
+}
+
+VkResult MicroVulkanDescriptorAllocator::AcquirePool(
+	const MicroVulkanDevice& device,
+	const VkDescriptorPoolCreateFlags flags,
+	VkDescriptorPool& pool
+) {
+	if ( flags == VK_UNUSED_FLAG && !m_free_pools.empty( ) ) {
+		pool = m_free_pools.back( );
+
+		m_free_pools.pop_back( );
+
+		return VK_SUCCESS;
+	}
+
+	return CreatePool( device, flags, pool );
+}
+
+void MicroVulkanDescriptorAllocator::ReleasePool(
+	const MicroVulkanDevice& device,
+	const VkDescriptorPoolCreateFlags flags,
+	VkDescriptorPool& pool
+) {
+	// Transient pools are empty until used, they go back to the free list
+	// while persistent ones are simply dropped.
+	if ( flags == VK_UNUSED_FLAG )
+		m_free_pools.emplace_back( pool );
+	else
+		vk::DestroyDescriptorPool( device, pool );
+
+	pool = VK_NULL_HANDLE;
+}
+
+VkResult MicroVulkanDescriptorAllocator::AllocateFrom(
+	const MicroVulkanDevice& device,
+	const VkDescriptorPoolCreateFlags flags,
+	const VkDescriptorSetLayout& layout,
+	std::vector<VkDescriptorPool>& pools,
+	VkDescriptorSet& descriptor,
+	VkDescriptorPool& pool
+) {
+	auto descriptors	 = std::vector<VkDescriptorSet>{ };
+	auto descriptor_spec = VkDescriptorSetAllocateInfo{ };
+	auto result			 = VK_ERROR_OUT_OF_POOL_MEMORY;
+	auto pool_id		 = (uint32_t)pools.size( );
+	auto pool_end		 = ( flags == VK_UNUSED_FLAG && pool_id > 0 ) ? pool_id - 1 : 0;
+
+	descriptor_spec.sType			   = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+	descriptor_spec.pNext			   = VK_NULL_HANDLE;
+	descriptor_spec.descriptorSetCount = 1;
+	descriptor_spec.pSetLayouts		   = micro_ptr( layout );
+
+	// Released sets give capacity back to any persistent pool, they're all
+	// tried newest first. Transient pools only fill up, so only the last one
+	// can still have room.
+	while ( 
+		pool_id-- > pool_end &&
+		( result == VK_ERROR_OUT_OF_POOL_MEMORY || result == VK_ERROR_FRAGMENTED_POOL )
+	) {
+		descriptor_spec.descriptorPool = pools[ pool_id ];
+
+		result = vk::AllocateDescriptors( device, descriptor_spec, descriptors );
+	}
+
+	// A full or fragmented pool is never an error for the caller, a fresh
+	// pool is chained and the allocation retried once. A pool that can't
+	// hold the set isn't kept.
+	if ( result == VK_ERROR_OUT_OF_POOL_MEMORY || result == VK_ERROR_FRAGMENTED_POOL ) {
+		auto fresh = VkDescriptorPool{ VK_NULL_HANDLE };
+
+		result = AcquirePool( device, flags, fresh );
+
+		if ( result != VK_SUCCESS )
+			return result;
+
+		descriptor_spec.descriptorPool = fresh;
+
+		result = vk::AllocateDescriptors( device, descriptor_spec, descriptors );
+
+		if ( result != VK_SUCCESS ) {
+			ReleasePool( device, flags, fresh );
+
+			return result;
+		}
+
+		pools.emplace_back( fresh );
+	}
+
+	if ( result == VK_SUCCESS ) {
+		descriptor = descriptors[ 0 ];
+		pool	   = descriptor_spec.descriptorPool;
+	}
+
+	return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t MicroVulkanDescriptorAllocator::GetPoolCount( ) const {
+	auto lock		= std::unique_lock{ m_mutex };
+	auto pool_count = (uint32_t)( m_pools.size( ) + m_free_pools.size( ) );
+
+	for ( auto& pools : m_frame_pools )
+		pool_count += (uint32_t)pools.size( );
+
+	return pool_count;
+}
@@ -0,0 +1,121 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "../../Pipelines/MicroVulkanShaderReflection.h"
+
+micro_class MicroVulkanDescriptorAllocator final {
+
+	constexpr static uint32_t POOL_SETS		= 64;
+	constexpr static uint32_t POOL_MAX_SETS = 4096;
+
+private:
+	std::vector<VkDescriptorPoolSize> m_ratios;
+	std::map<VkDescriptorType, uint32_t> m_limits;
+	uint32_t m_set_count;
+	std::vector<VkDescriptorPool> m_pools;
+	std::vector<VkDescriptorPool> m_free_pools;
+	std::vector<std::vector<VkDescriptorPool>> m_frame_pools;
+	std::unordered_map<VkDescriptorSet, VkDescriptorPool> m_sets;
+	mutable std::mutex m_mutex;
+
+public:
+	MicroVulkanDescriptorAllocator( );
+
+	MicroVulkanDescriptorAllocator( const MicroVulkanDescriptorAllocator& ) = delete;
+
+	~MicroVulkanDescriptorAllocator( ) = default;
+
+	bool Create(
+		const MicroVulkanPipelines& pipelines,
+		const uint32_t frame_count
+	);
+
+	VkResult Allocate(
+		const MicroVulkanDevice& device,
+		const VkDescriptorSetLayout& layout,
+		VkDescriptorSet& descriptor
+	);
+
+	VkResult Allocate(
+		const MicroVulkanDevice& device,
+		const uint32_t frame_id,
+		const VkDescriptorSetLayout& layout,
+		VkDescriptorSet& descriptor
+	);
+
+	VkResult Allocate(
+		const MicroVulkanDevice& device,
+		const std::vector<VkDescriptorSetLayout>& layouts,
+		std::vector<VkDescriptorSet>& descriptors
+	);
+
+	void Release( const MicroVulkanDevice& device, VkDescriptorSet& descriptor );
+
+	void Reset( const MicroVulkanDevice& device, const uint32_t frame_id );
+
+	void Destroy( const MicroVulkanDevice& device );
+
+private:
+	std::vector<VkDescriptorPoolSize> CreatePoolSizes( const uint32_t set_count );
+
+	VkResult CreatePool(
+		const MicroVulkanDevice& device,
+		const VkDescriptorPoolCreateFlags flags,
+		VkDescriptorPool& pool
+	);
+
+	VkResult AcquirePool(
+		const MicroVulkanDevice& device,
+		const VkDescriptorPoolCreateFlags flags,
+		VkDescriptorPool& pool
+	);
+
+	void ReleasePool(
+		const MicroVulkanDevice& device,
+		const VkDescriptorPoolCreateFlags flags,
+		VkDescriptorPool& pool
+	);
+
+	VkResult AllocateFrom(
+		const MicroVulkanDevice& device,
+		const VkDescriptorPoolCreateFlags flags,
+		const VkDescriptorSetLayout& layout,
+		std::vector<VkDescriptorPool>& pools,
+		VkDescriptorSet& descriptor,
+		VkDescriptorPool& pool
+	);
+
+public:
+	uint32_t GetPoolCount( ) const;
+
+};
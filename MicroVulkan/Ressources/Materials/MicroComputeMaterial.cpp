@@ -0,0 +1,295 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "__micro_vulkan_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+MicroComputeMaterial::MicroComputeMaterial( )
+	: m_pipeline{ VK_NULL_HANDLE },
+	m_layout{ VK_NULL_HANDLE },
+	m_shader{ VK_NULL_HANDLE },
+	m_descriptors{ },
+	m_set_layouts{ },
+	m_push_constants{ },
+	m_local_size{ 0, 0, 0 },
+	m_set_offset{ 0 },
+	m_is_reflected{ false }
+{ }
+
+bool MicroComputeMaterial::Create(
+	MicroVulkan& vulkan,
+	const MicroComputeMaterialSpecification& specification
+) {
+	auto& pipelines	  = vulkan.GetPipelines( );
+	auto& registry	  = vulkan.GetPipelineRegistry( );
+	auto& shaders	  = vulkan.GetShaderRegistry( );
+	auto& descriptors = vulkan.GetDescriptorAllocator( );
+	auto& bindless	  = vulkan.GetBindless( );
+	auto& device	  = vulkan.GetDevice( );
+	auto layout_hash  = (uint64_t)0;
+
+	micro_assert( specification.Shader.Stage == VK_SHADER_STAGE_COMPUTE_BIT, "You can't create a compute material from a non compute shader" );
+
+	return	CreateReflection( device, registry, specification )						   &&
+			CreateLayout( device, registry, bindless, specification, layout_hash )	   &&
+			descriptors.Allocate( device, m_set_layouts, m_descriptors ) == VK_SUCCESS &&
+			CreatePipeline( device, pipelines, registry, shaders, specification, layout_hash );
+}
+
+void MicroComputeMaterial::Destroy( MicroVulkan& vulkan ) {
+	auto& device	  = vulkan.GetDevice( );
+	auto& registry	  = vulkan.GetPipelineRegistry( );
+	auto& shaders	  = vulkan.GetShaderRegistry( );
+	auto& descriptors = vulkan.GetDescriptorAllocator( );
+
+	shaders.Release( device, m_shader );
+
+	for ( auto& descriptor : m_descriptors )
+		descriptors.Release( device, descriptor );
+
+	m_descriptors.clear( );
+
+	if ( m_is_reflected ) {
+		for ( auto& layout : m_set_layouts )
+			registry.Release( device, layout );
+	}
+
+	m_set_layouts.clear( );
+	m_push_constants.clear( );
+	registry.Release( device, m_pipeline );
+	registry.Release( device, m_layout );
+
+	m_local_size   = { 0, 0, 0 };
+	m_set_offset   = 0;
+	m_is_reflected = false;
+}
+
+void MicroComputeMaterial::CmdBind( const VkCommandBuffer& commands ) {
+	// As for graphic materials the global bindless set is bound by the
+	// caller, only the sets after it belong to the material.
+	vk::CmdBindPipeline( commands, VK_PIPELINE_BIND_POINT_COMPUTE, m_pipeline );
+	vk::CmdBindDescriptorSets( commands, VK_PIPELINE_BIND_POINT_COMPUTE, m_layout, m_set_offset, m_descriptors );
+}
+
+void MicroComputeMaterial::CmdPushConstants(
+	const VkCommandBuffer& commands,
+	const uint32_t offset,
+	const uint32_t length,
+	const void* data
+) {
+	vk::CmdPushConstants( commands, m_layout, VK_SHADER_STAGE_COMPUTE_BIT, offset, length, data );
+}
+
+void MicroComputeMaterial::CmdDispatch( const VkCommandBuffer& commands, const VkExtent3D& group_count ) {
+	vk::CmdDispatch( commands, group_count );
+}
+
+void MicroComputeMaterial::CmdDispatchSize( const VkCommandBuffer& commands, const VkExtent3D& size ) {
+	auto group_count = vk::GetDispatchSize( size, m_local_size );
+
+	vk::CmdDispatch( commands, group_count );
+}
+
+void MicroComputeMaterial::CmdDispatchIndirect(
+	const VkCommandBuffer& commands,
+	const VkBuffer& buffer,
+	const VkDeviceSize offset
+) {
+	vk::CmdDispatchIndirect( commands, buffer, offset );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool MicroComputeMaterial::CreateReflection(
+	const MicroVulkanDevice& device,
+	MicroVulkanPipelineRegistry& registry,
+	const MicroComputeMaterialSpecification& specification
+) {
+	auto reflection = MicroVulkanShaderReflection{ };
+	auto first_set	= specification.Bindless ? 1u : 0u;
+
+	// The shader is always reflected for its workgroup size, layouts are
+	// only derived from it when the specification provides none. A size
+	// set by specialization constants uses the specialized values.
+	if ( !reflection.Append( specification.Shader.Stage, specification.Shader.Code ) )
+		return false;
+
+	m_local_size	 = reflection.GetLocalSize( specification.Shader.GetSpecialization( ) );
+	m_set_layouts	 = specification.Layouts;
+	m_push_constants = specification.PushConstants;
+	m_is_reflected	 = specification.Layouts.empty( ) && specification.PushConstants.empty( );
+
+	if ( !m_is_reflected )
+		return true;
+
+	m_push_constants = reflection.GetPushConstants( );
+
+	return reflection.Acquire( device, registry, first_set, m_set_layouts );
+}
+
+bool MicroComputeMaterial::CreateLayout(
+	const MicroVulkanDevice& device,
+	MicroVulkanPipelineRegistry& registry,
+	const MicroVulkanBindless& bindless,
+	const MicroComputeMaterialSpecification& specification,
+	uint64_t& layout_hash
+) {
+	auto layouts = std::vector<VkDescriptorSetLayout>{ };
+
+	layout_hash = registry.CreateLayoutHash( m_set_layouts, m_push_constants, specification.Bindless );
+
+	if ( specification.Bindless ) {
+		if ( !bindless.GetIsValid( ) )
+			return false;
+
+		layouts.emplace_back( bindless.GetLayout( ) );
+
+		m_set_offset = 1;
+	}
+
+	// Layouts are shared with graphic materials, a compute shader using the
+	// same sets and push constants gets the same pipeline layout.
+	if ( registry.Acquire( layout_hash, m_layout ) )
+		return true;
+
+	auto layout_spec = VkPipelineLayoutCreateInfo{ };
+
+	layouts.insert( layouts.end( ), m_set_layouts.begin( ), m_set_layouts.end( ) );
+
+	layout_spec.sType				   = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+	layout_spec.pNext				   = VK_NULL_HANDLE;
+	layout_spec.flags				   = VK_UNUSED_FLAG;
+	layout_spec.setLayoutCount		   = (uint32_t)layouts.size( );
+	layout_spec.pSetLayouts			   = layouts.data( );
+	layout_spec.pushConstantRangeCount = (uint32_t)m_push_constants.size( );
+	layout_spec.pPushConstantRanges	   = m_push_constants.data( );
+
+	if ( vk::CreatePipelineLayout( device, layout_spec, m_layout ) != VK_SUCCESS )
+		return false;
+
+	registry.Register( device, layout_hash, m_layout );
+
+	return true;
+}
+
+uint64_t MicroComputeMaterial::CreatePipelineHash(
+	const MicroVulkanShaderRegistry& shaders,
+	const MicroComputeMaterialSpecification& specification,
+	const uint64_t layout_hash
+) {
+	auto& shader = specification.Shader;
+	auto hash	 = MicroVulkanHash{ };
+
+	hash.Combine( VK_PIPELINE_BIND_POINT_COMPUTE );
+	hash.Combine( layout_hash );
+	hash.Combine( shader.Name );
+	hash.Combine( shaders.CreateHash( shader.Code ) );
+	hash.Combine( shader.Entries );
+	hash.Combine( shader.Constants );
+
+	return hash;
+}
+
+bool MicroComputeMaterial::CreatePipeline(
+	const MicroVulkanDevice& device,
+	MicroVulkanPipelines& pipelines,
+	MicroVulkanPipelineRegistry& registry,
+	MicroVulkanShaderRegistry& shaders,
+	const MicroComputeMaterialSpecification& specification,
+	const uint64_t layout_hash
+) {
+	auto pipeline_hash = CreatePipelineHash( shaders, specification, layout_hash );
+
+	if ( registry.Acquire( pipeline_hash, m_pipeline ) )
+		return true;
+
+	auto& shader		= specification.Shader;
+	auto specialization = shader.GetSpecialization( );
+	auto pipeline_spec	= VkComputePipelineCreateInfo{ };
+
+	if ( !shaders.Acquire( device, shader.Code, m_shader ) )
+		return false;
+
+	pipeline_spec.sType						= VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+	pipeline_spec.pNext						= VK_NULL_HANDLE;
+	pipeline_spec.flags						= VK_UNUSED_FLAG;
+	pipeline_spec.stage.sType				= VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+	pipeline_spec.stage.pNext				= VK_NULL_HANDLE;
+	pipeline_spec.stage.flags				= VK_UNUSED_FLAG;
+	pipeline_spec.stage.stage				= VK_SHADER_STAGE_COMPUTE_BIT;
+	pipeline_spec.stage.module				= m_shader;
+	pipeline_spec.stage.pName				= shader.Name.c_str( );
+	pipeline_spec.stage.pSpecializationInfo = VK_NULL_HANDLE;
+	pipeline_spec.layout					= m_layout;
+	pipeline_spec.basePipelineHandle		= VK_NULL_HANDLE;
+	pipeline_spec.basePipelineIndex			= 0;
+
+	if ( specialization.mapEntryCount > 0 )
+		pipeline_spec.stage.pSpecializationInfo = micro_ptr( specialization );
+
+	if ( vk::CreatePipeline( device, pipelines.GetCache( ), pipeline_spec, m_pipeline ) != VK_SUCCESS )
+		return false;
+
+	registry.Register( device, pipeline_hash, m_pipeline );
+	pipelines.Notify( );
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+VkPipeline MicroComputeMaterial::GetPipeline( ) const {
+	return m_pipeline;
+}
+
+VkPipelineLayout MicroComputeMaterial::GetLayout( ) const {
+	return m_layout;
+}
+
+const std::vector<VkDescriptorSet>& MicroComputeMaterial::GetDescriptors( ) const {
+	return m_descriptors;
+}
+
+const std::vector<VkDescriptorSetLayout>& MicroComputeMaterial::GetSetLayouts( ) const {
+	return m_set_layouts;
+}
+
+const std::vector<VkPushConstantRange>& MicroComputeMaterial::GetPushConstants( ) const {
+	return m_push_constants;
+}
+
+const VkExtent3D& MicroComputeMaterial::GetLocalSize( ) const {
+	return m_local_size;
+}
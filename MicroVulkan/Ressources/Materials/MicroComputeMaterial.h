@@ -0,0 +1,123 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "MicroComputeMaterialSpecification.h"
+
+micro_class MicroComputeMaterial {
+
+private:
+	VkPipeline m_pipeline;
+	VkPipelineLayout m_layout;
+	VkShaderModule m_shader;
+	std::vector<VkDescriptorSet> m_descriptors;
+	std::vector<VkDescriptorSetLayout> m_set_layouts;
+	std::vector<VkPushConstantRange> m_push_constants;
+	VkExtent3D m_local_size;
+	uint32_t m_set_offset;
+	bool m_is_reflected;
+
+public:
+	MicroComputeMaterial( );
+
+	~MicroComputeMaterial( ) = default;
+
+	bool Create(
+		MicroVulkan& vulkan,
+		const MicroComputeMaterialSpecification& specification
+	);
+
+	void Destroy( MicroVulkan& vulkan );
+
+	void CmdBind( const VkCommandBuffer& commands );
+
+	void CmdPushConstants(
+		const VkCommandBuffer& commands,
+		const uint32_t offset,
+		const uint32_t length,
+		const void* data
+	);
+
+	void CmdDispatch( const VkCommandBuffer& commands, const VkExtent3D& group_count );
+
+	void CmdDispatchSize( const VkCommandBuffer& commands, const VkExtent3D& size );
+
+	void CmdDispatchIndirect(
+		const VkCommandBuffer& commands,
+		const VkBuffer& buffer,
+		const VkDeviceSize offset
+	);
+
+private:
+	bool CreateReflection(
+		const MicroVulkanDevice& device,
+		MicroVulkanPipelineRegistry& registry,
+		const MicroComputeMaterialSpecification& specification
+	);
+
+	bool CreateLayout(
+		const MicroVulkanDevice& device,
+		MicroVulkanPipelineRegistry& registry,
+		const MicroVulkanBindless& bindless,
+		const MicroComputeMaterialSpecification& specification,
+		uint64_t& layout_hash
+	);
+
+	uint64_t CreatePipelineHash(
+		const MicroVulkanShaderRegistry& shaders,
+		const MicroComputeMaterialSpecification& specification,
+		const uint64_t layout_hash
+	);
+
+	bool CreatePipeline(
+		const MicroVulkanDevice& device,
+		MicroVulkanPipelines& pipelines,
+		MicroVulkanPipelineRegistry& registry,
+		MicroVulkanShaderRegistry& shaders,
+		const MicroComputeMaterialSpecification& specification,
+		const uint64_t layout_hash
+	);
+
+public:
+	VkPipeline GetPipeline( ) const;
+
+	VkPipelineLayout GetLayout( ) const;
+
+	const std::vector<VkDescriptorSet>& GetDescriptors( ) const;
+
+	const std::vector<VkDescriptorSetLayout>& GetSetLayouts( ) const;
+
+	const std::vector<VkPushConstantRange>& GetPushConstants( ) const;
+
+	const VkExtent3D& GetLocalSize( ) const;
+
+};
@@ -36,81 +36,377 @@
 ////////////////////////////////////////////////////////////////////////////////////////////
 MicroMaterial::MicroMaterial( )
     : m_pipeline{ VK_NULL_HANDLE },
+    m_placeholder{ VK_NULL_HANDLE },
     m_layout{ VK_NULL_HANDLE },
-    m_pool{ VK_NULL_HANDLE },
-    m_descriptors{ }
+    m_pending{ },
+    m_shaders{ },
+    m_descriptors{ },
+    m_set_layouts{ },
+    m_push_constants{ },
+    m_dynamic_states{ },
+    m_dynamic{ },
+    m_libraries{ },
+    m_shader_stages{ },
+    m_shader_objects{ },
+    m_set_offset{ 0 },
+    m_is_reflected{ false }
 { }
 
 bool MicroMaterial::Create( 
-    const MicroVulkan& vulkan,
+    MicroVulkan& vulkan,
     const MicroMaterialSpecification& specification 
 ) {
-    auto& pipelines = vulkan.GetPipelines( );
-	auto& device = vulkan.GetDevice( );
-    auto& passes = vulkan.GetRenderPasses( );
+    auto& pipelines   = vulkan.GetPipelines( );
+    auto& registry    = vulkan.GetPipelineRegistry( );
+    auto& shaders     = vulkan.GetShaderRegistry( );
+    auto& descriptors = vulkan.GetDescriptorAllocator( );
+    auto& bindless    = vulkan.GetBindless( );
+	auto& device      = vulkan.GetDevice( );
+    auto& passes      = vulkan.GetRenderPasses( );
+    auto layout_hash  = (uint64_t)0;
 
-    return  CreateLayout( device ) &&
-            CreatePipeline( device, pipelines, passes, specification );
+    m_dynamic_states = CreateDynamicStates( device );
+    m_dynamic        = CreateDynamicSpec( specification );
+
+    if (
+        !CreateReflection( device, registry, specification )                    ||
+        !CreateLayout( device, registry, bindless, specification, layout_hash ) ||
+        descriptors.Allocate( device, m_set_layouts, m_descriptors ) != VK_SUCCESS
+    )
+        return false;
+
+    if ( device.GetHasShaderObject( ) )
+        return CreateShaderObjects( device, registry, shaders, bindless, specification, layout_hash );
+
+    return CreatePipeline( device, pipelines, registry, shaders, passes, specification, layout_hash, m_pipeline );
 }
 
-void MicroMaterial::Destroy( const MicroVulkan& vulkan ) {
-	auto& device = vulkan.GetDevice( );
+std::shared_future<VkPipeline> MicroMaterial::Create(
+    MicroVulkan& vulkan,
+    MicroVulkanWorkerPool& workers,
+    const MicroMaterialSpecification& specification,
+    const VkPipeline placeholder
+) {
+    auto& pipelines   = vulkan.GetPipelines( );
+    auto& registry    = vulkan.GetPipelineRegistry( );
+    auto& shaders     = vulkan.GetShaderRegistry( );
+    auto& descriptors = vulkan.GetDescriptorAllocator( );
+    auto& bindless    = vulkan.GetBindless( );
+	auto& device      = vulkan.GetDevice( );
+    auto& passes      = vulkan.GetRenderPasses( );
+    auto layout_hash  = (uint64_t)0;
+
+    m_placeholder    = placeholder;
+    m_dynamic_states = CreateDynamicStates( device );
+    m_dynamic        = CreateDynamicSpec( specification );
+
+    if ( 
+        !CreateReflection( device, registry, specification )                    ||
+        !CreateLayout( device, registry, bindless, specification, layout_hash ) ||
+        descriptors.Allocate( device, m_set_layouts, m_descriptors ) != VK_SUCCESS
+    ) {
+        auto failure = std::promise<VkPipeline>{ };
+
+        failure.set_value( VK_NULL_HANDLE );
 
-    vk::DeallocateDescriptors( device, m_pool, m_descriptors );
-	vk::DestroyDescriptorPool( device, m_pool );
-	vk::DestroyPipelineLayout( device, m_layout );
-	vk::DestroyPipeline( device, m_pipeline );
+        m_pending = failure.get_future( ).share( );
+
+        return m_pending;
+    }
+
+    // The task owns a copy of the specification, stage names and SPIR-V must
+    // outlive the caller. VkPipelineCache is internally synchronized so every
+    // worker compiles against the shared cache. Shader objects resolve the
+    // future without a pipeline, the placeholder is bound until then.
+    auto task = [ this, &device, &pipelines, &registry, &shaders, &bindless, &passes, specification, layout_hash ]( ) {
+        auto pipeline = VkPipeline{ VK_NULL_HANDLE };
+
+        if ( device.GetHasShaderObject( ) )
+            CreateShaderObjects( device, registry, shaders, bindless, specification, layout_hash );
+        else
+            CreatePipeline( device, pipelines, registry, shaders, passes, specification, layout_hash, pipeline );
+
+        return pipeline;
+    };
+
+    m_pending = workers.Dispatch( std::move( task ) ).share( );
+
+    return m_pending;
 }
 
-bool MicroMaterial::CreateLayout(
-    const MicroVulkanDevice& device
+void MicroMaterial::Destroy( MicroVulkan& vulkan ) {
+	auto& device      = vulkan.GetDevice( );
+    auto& registry    = vulkan.GetPipelineRegistry( );
+    auto& shaders     = vulkan.GetShaderRegistry( );
+    auto& descriptors = vulkan.GetDescriptorAllocator( );
+
+    if ( m_pending.valid( ) ) {
+        m_pipeline = m_pending.get( );
+        m_pending  = { };
+    }
+
+    for ( auto& shader : m_shaders )
+        shaders.Release( device, shader );
+
+    m_shaders.clear( );
+
+    for ( auto& descriptor : m_descriptors )
+        descriptors.Release( device, descriptor );
+
+    m_descriptors.clear( );
+
+    if ( m_is_reflected ) {
+        for ( auto& layout : m_set_layouts )
+            registry.Release( device, layout );
+    }
+
+    for ( auto& library : m_libraries )
+        registry.Release( device, library );
+
+    for ( auto& shader_object : m_shader_objects )
+        registry.Release( device, shader_object );
+
+    m_libraries.clear( );
+    m_shader_stages.clear( );
+    m_shader_objects.clear( );
+    m_set_layouts.clear( );
+    m_push_constants.clear( );
+    m_dynamic_states.clear( );
+    registry.Release( device, m_pipeline );
+    registry.Release( device, m_layout );
+
+    m_dynamic      = { };
+    m_set_offset   = 0;
+    m_is_reflected = false;
+}
+
+bool MicroMaterial::Swap( MicroMaterial& other ) {
+    // Layouts are shared through the registry, equal handles mean the set
+    // layouts and push constant ranges are identical.
+    if ( !GetIsReady( ) || !other.GetIsReady( ) || m_layout != other.m_layout )
+        return false;
+
+    GetPipeline( );
+    other.GetPipeline( );
+
+    if ( !vk::IsValid( other.m_pipeline ) && other.m_shader_objects.empty( ) )
+        return false;
+
+    std::swap( m_pipeline, other.m_pipeline );
+    std::swap( m_shaders, other.m_shaders );
+    std::swap( m_libraries, other.m_libraries );
+    std::swap( m_shader_stages, other.m_shader_stages );
+    std::swap( m_shader_objects, other.m_shader_objects );
+
+    return true;
+}
+
+void MicroMaterial::CmdBind( const VkCommandBuffer& commands ) {
+    // Shader objects must be recorded inside a dynamic rendering instance,
+    // the placeholder pipeline is bound while they are still pending.
+    if ( GetIsReady( ) && !m_shader_objects.empty( ) )
+        vk::CmdBindShaderObjects( commands, m_shader_stages, m_shader_objects );
+    else
+        vk::CmdBindPipeline( commands, VK_PIPELINE_BIND_POINT_GRAPHICS, GetPipeline( ) );
+
+    vk::CmdSetDynamicState( commands, m_dynamic_states, m_dynamic );
+
+    // Bindless materials only own the sets after the global one, binding
+    // the global set is left to the caller once per command buffer.
+    vk::CmdBindDescriptorSets( commands, VK_PIPELINE_BIND_POINT_GRAPHICS, m_layout, m_set_offset, m_descriptors );
+}
+
+void MicroMaterial::CmdPushConstants(
+    const VkCommandBuffer& commands,
+    const VkShaderStageFlags stages,
+    const uint32_t offset,
+    const uint32_t length,
+    const void* data
 ) {
-    auto layout_spec = VkPipelineLayoutCreateInfo{ };
+    vk::CmdPushConstants( commands, m_layout, stages, offset, length, data );
+}
 
-    layout_spec.sType                  = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-    layout_spec.pNext                  = VK_NULL_HANDLE;
-    layout_spec.flags                  = VK_UNUSED_FLAG;
-    layout_spec.setLayoutCount         = 0;
-    layout_spec.pSetLayouts            = nullptr;
-    layout_spec.pushConstantRangeCount = 0;
-    layout_spec.pPushConstantRanges    = nullptr;
-    
-    return vk::CreatePipelineLayout( device, layout_spec, m_layout ) == VK_SUCCESS;
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool MicroMaterial::CreateReflection(
+    const MicroVulkanDevice& device,
+    MicroVulkanPipelineRegistry& registry,
+    const MicroMaterialSpecification& specification
+) {
+    m_set_layouts    = specification.Layouts;
+    m_push_constants = specification.PushConstants;
+    m_is_reflected   = specification.Layouts.empty( ) && specification.PushConstants.empty( );
+
+    if ( !m_is_reflected )
+        return true;
+
+    // Layouts are derived from the SPIR-V when none are provided, set
+    // layouts come from the registry so identical shaders share them and
+    // their pipeline layout.
+    auto reflection = MicroVulkanShaderReflection{ };
+    auto first_set  = specification.Bindless ? 1u : 0u;
+
+    for ( auto& shader : specification.Shaders ) {
+        if ( !reflection.Append( shader.Stage, shader.Code ) )
+            return false;
+    }
+
+    m_push_constants = reflection.GetPushConstants( );
+
+    return reflection.Acquire( device, registry, first_set, m_set_layouts );
+}
+
+uint64_t MicroMaterial::CreatePartHash(
+    const MicroVulkanShaderRegistry& shaders,
+    const MicroMaterialSpecification& specification,
+    const uint64_t layout_hash,
+    const VkGraphicsPipelineLibraryFlagBitsEXT part
+) {
+    auto hash = MicroVulkanHash{ };
+
+    hash.Combine( part );
+    hash.Combine( m_dynamic_states );
+
+    if ( part == VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT ) {
+        hash.Combine( specification.Bindings );
+        hash.Combine( specification.Attributes );
+        hash.Combine( specification.Topology );
+
+        return hash;
+    }
+
+    // Render passes are created once from the application specification,
+    // their index names them across recreations.
+    hash.Combine( specification.RenderPass );
+    hash.Combine( specification.Subpass );
+
+    if ( part == VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT ) {
+        hash.Combine( specification.Samples );
+
+        // Blend attachments only matter by count once the whole blend state
+        // is recorded at bind time.
+        if (
+            GetIsDynamic( VK_DYNAMIC_STATE_COLOR_BLEND_ENABLE_EXT )   &&
+            GetIsDynamic( VK_DYNAMIC_STATE_COLOR_BLEND_EQUATION_EXT ) &&
+            GetIsDynamic( VK_DYNAMIC_STATE_COLOR_WRITE_MASK_EXT )
+        )
+            hash.Combine( (uint64_t)specification.Blends.size( ) );
+        else
+            hash.Combine( specification.Blends );
+
+        return hash;
+    }
+
+    auto is_fragment = part == VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT;
+
+    hash.Combine( layout_hash );
+
+    for ( auto& shader : specification.Shaders ) {
+        if ( ( shader.Stage == VK_SHADER_STAGE_FRAGMENT_BIT ) != is_fragment )
+            continue;
+
+        hash.Combine( shader.Stage );
+        hash.Combine( shader.Name );
+        hash.Combine( shaders.CreateHash( shader.Code ) );
+        hash.Combine( shader.Entries );
+        hash.Combine( shader.Constants );
+    }
+
+    // Values the pipeline leaves dynamic are excluded so materials that only
+    // differ by them share the same part.
+    if ( is_fragment ) {
+        hash.Combine( specification.Samples );
+
+        if ( !GetIsDynamic( VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE ) )
+            hash.Combine( specification.DepthTest );
+
+        if ( !GetIsDynamic( VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE ) )
+            hash.Combine( specification.DepthWrite );
+
+        if ( !GetIsDynamic( VK_DYNAMIC_STATE_DEPTH_COMPARE_OP ) )
+            hash.Combine( specification.DepthCompare );
+    } else {
+        if ( !GetIsDynamic( VK_DYNAMIC_STATE_POLYGON_MODE_EXT ) )
+            hash.Combine( specification.PolygonMode );
+
+        if ( !GetIsDynamic( VK_DYNAMIC_STATE_CULL_MODE ) )
+            hash.Combine( specification.CullMode );
+
+        if ( !GetIsDynamic( VK_DYNAMIC_STATE_FRONT_FACE ) )
+            hash.Combine( specification.FrontFace );
+    }
+
+    return hash;
 }
 
-bool MicroMaterial::CreateDescriporPool(
-    const MicroVulkanDevice& device
+uint64_t MicroMaterial::CreatePipelineHash(
+    const MicroVulkanShaderRegistry& shaders,
+    const MicroMaterialSpecification& specification,
+    const uint64_t layout_hash
 ) {
-    auto pool_spec = VkDescriptorPoolCreateInfo{ };
+    auto hash = MicroVulkanHash{ };
 
-    pool_spec.sType         = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
-    pool_spec.pNext         = VK_NULL_HANDLE;
-    pool_spec.flags         = VK_UNUSED_FLAG;
-    pool_spec.maxSets       = 0;
-    pool_spec.poolSizeCount = 0;
-    pool_spec.pPoolSizes    = nullptr;
+    hash.Combine( CreatePartHash( shaders, specification, layout_hash, VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT ) );
+    hash.Combine( CreatePartHash( shaders, specification, layout_hash, VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT ) );
+    hash.Combine( CreatePartHash( shaders, specification, layout_hash, VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT ) );
+    hash.Combine( CreatePartHash( shaders, specification, layout_hash, VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT ) );
 
-    return vk::CreateDescriptorPool( device, pool_spec, m_pool ) == VK_SUCCESS;
+    return hash;
 }
 
-bool MicroMaterial::CreateDescriptors(
-    const MicroVulkanDevice& device
+bool MicroMaterial::CreateLayout(
+    const MicroVulkanDevice& device,
+    MicroVulkanPipelineRegistry& registry,
+    const MicroVulkanBindless& bindless,
+    const MicroMaterialSpecification& specification,
+    uint64_t& layout_hash
 ) {
-    auto descriptor_spec = VkDescriptorSetAllocateInfo{ };
+    auto layouts = std::vector<VkDescriptorSetLayout>{ };
+
+    layout_hash = registry.CreateLayoutHash( m_set_layouts, m_push_constants, specification.Bindless );
+
+    // The global bindless set always sits at set 0, the specification
+    // layouts follow it.
+    if ( specification.Bindless ) {
+        if ( !bindless.GetIsValid( ) )
+            return false;
 
-    descriptor_spec.sType              = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-    descriptor_spec.pNext              = VK_NULL_HANDLE;
-    descriptor_spec.descriptorPool     = m_pool;
-    descriptor_spec.descriptorSetCount = 0;
-    descriptor_spec.pSetLayouts        = nullptr;
+        layouts.emplace_back( bindless.GetLayout( ) );
 
-    return vk::AllocateDescriptors( device, descriptor_spec, m_descriptors ) == VK_SUCCESS;
+        m_set_offset = 1;
+    }
+
+    if ( registry.Acquire( layout_hash, m_layout ) )
+        return true;
+
+    auto layout_spec = VkPipelineLayoutCreateInfo{ };
+
+    layouts.insert( layouts.end( ), m_set_layouts.begin( ), m_set_layouts.end( ) );
+
+    layout_spec.sType                  = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    layout_spec.pNext                  = VK_NULL_HANDLE;
+    layout_spec.flags                  = VK_UNUSED_FLAG;
+    layout_spec.setLayoutCount         = (uint32_t)layouts.size( );
+    layout_spec.pSetLayouts            = layouts.data( );
+    layout_spec.pushConstantRangeCount = (uint32_t)m_push_constants.size( );
+    layout_spec.pPushConstantRanges    = m_push_constants.data( );
+    
+    if ( vk::CreatePipelineLayout( device, layout_spec, m_layout ) != VK_SUCCESS )
+        return false;
+
+    registry.Register( device, layout_hash, m_layout );
+
+    return true;
 }
 
 void MicroMaterial::CreateStageSpec(
     const MicroShaderSpecification& shader_spec,
+    VkSpecializationInfo& specialization,
     VkPipelineShaderStageCreateInfo& stage_spec
 ) {
+    specialization = shader_spec.GetSpecialization( );
+
     stage_spec.sType               = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
     stage_spec.pNext               = VK_NULL_HANDLE;
     stage_spec.flags               = VK_UNUSED_FLAG;
@@ -118,55 +414,206 @@ void MicroMaterial::CreateStageSpec(
     stage_spec.module              = VK_NULL_HANDLE;
     stage_spec.pName               = shader_spec.Name.c_str( );
     stage_spec.pSpecializationInfo = VK_NULL_HANDLE;
+
+    if ( specialization.mapEntryCount > 0 )
+        stage_spec.pSpecializationInfo = micro_ptr( specialization );
+}
+
+std::vector<VkPipelineShaderStageCreateInfo> MicroMaterial::CreatePipelineStagesSpec(
+    const MicroMaterialSpecification& specification,
+    std::vector<VkSpecializationInfo>& specializations
+) {
+    auto shader_count = specification.Shaders.size( );
+    auto shader_stage_spec = std::vector<VkPipelineShaderStageCreateInfo>( shader_count );
+
+    micro_assert( shader_count >= 2, "You can't create a material without at least 2 shaders corresponding to Vertex & Fragment" );
+
+    specializations.resize( shader_count );
+
+    while ( shader_count-- > 0 )
+        CreateStageSpec( specification.Shaders[ shader_count ], specializations[ shader_count ], shader_stage_spec[ shader_count ] );
+
+    return shader_stage_spec;
 }
 
-bool MicroMaterial::CreateShader( 
+bool MicroMaterial::CreateStageIdentifiers(
     const MicroVulkanDevice& device,
-    const std::vector<uint32_t>& code,
-    VkShaderModule& shader
+    MicroVulkanShaderRegistry& shaders,
+    const MicroMaterialSpecification& specification,
+    std::vector<VkPipelineShaderStageCreateInfo>& stages,
+    std::vector<VkPipelineShaderStageModuleIdentifierCreateInfoEXT>& identifiers,
+    std::vector<std::vector<uint8_t>>& identifier_data
 ) {
-    auto shader_spec = VkShaderModuleCreateInfo{ };
+    auto shader_count = stages.size( );
 
-    shader_spec.sType    = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-    shader_spec.pNext    = VK_NULL_HANDLE;
-    shader_spec.flags    = VK_UNUSED_FLAG;
-    shader_spec.codeSize = (uint32_t)code.size( );
-    shader_spec.pCode    = code.data( );
+    identifiers.resize( shader_count );
+    identifier_data.resize( shader_count );
+
+    while ( shader_count-- > 0 ) {
+        auto& identifier = identifiers[ shader_count ];
+        auto& data       = identifier_data[ shader_count ];
+
+        if ( !shaders.Acquire( device, specification.Shaders[ shader_count ].Code, data ) )
+            return false;
+
+        identifier.sType          = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_MODULE_IDENTIFIER_CREATE_INFO_EXT;
+        identifier.pNext          = VK_NULL_HANDLE;
+        identifier.identifierSize = (uint32_t)data.size( );
+        identifier.pIdentifier    = data.data( );
+
+        stages[ shader_count ].pNext = micro_ptr( identifier );
+    }
 
-    return vk::CreateShader( device, shader_spec, shader ) == VK_SUCCESS;
+    return true;
 }
 
-std::vector<VkPipelineShaderStageCreateInfo> MicroMaterial::CreatePipelineStagesSpec(
+bool MicroMaterial::CreateStageModules(
     const MicroVulkanDevice& device,
+    MicroVulkanShaderRegistry& shaders,
     const MicroMaterialSpecification& specification,
-    bool& can_create
+    std::vector<VkPipelineShaderStageCreateInfo>& stages
 ) {
-    auto shader_count = specification.Shaders.size( );
-    auto shader_stage_spec = std::vector<VkPipelineShaderStageCreateInfo>( shader_count );
+    auto shader_count = stages.size( );
 
-    micro_assert( shader_count < 2, "You can't create a material without at least 2 shaders corresponding to Vertex & Fragment" );
+    while ( shader_count-- > 0 ) {
+        auto& stage_spec = stages[ shader_count ];
 
-    while ( can_create && shader_count-- > 0 ) {
-        auto& shader_spec = specification.Shaders[ shader_count ];
-        auto& stage_spec  = shader_stage_spec[ shader_count ];
+        stage_spec.pNext = VK_NULL_HANDLE;
 
-        CreateStageSpec( shader_spec, stage_spec );
+        if ( !shaders.Acquire( device, specification.Shaders[ shader_count ].Code, stage_spec.module ) )
+            return false;
 
-        can_create = CreateShader( device, shader_spec.Code, stage_spec.module ) == VK_SUCCESS;
+        m_shaders.emplace_back( stage_spec.module );
     }
 
-    return shader_stage_spec;
+    return true;
 }
 
-std::vector<VkDynamicState> MicroMaterial::CreateDynamicStates( ) {
+std::vector<VkDynamicState> MicroMaterial::CreateDynamicStates( const MicroVulkanDevice& device ) {
     auto dynamic_states = std::vector<VkDynamicState>( 2 );
 
     dynamic_states[ 0 ] = VK_DYNAMIC_STATE_VIEWPORT;
     dynamic_states[ 1 ] = VK_DYNAMIC_STATE_SCISSOR;
 
+    // Shader objects have no static state, every state whose feature is
+    // enabled has to be recorded before drawing. Depth bounds, depth clamp,
+    // logic op and alpha to one are never enabled so they are left out.
+    if ( device.GetHasShaderObject( ) ) {
+        dynamic_states.insert(
+            dynamic_states.end( ),
+            {
+                VK_DYNAMIC_STATE_VERTEX_INPUT_EXT,
+                VK_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY,
+                VK_DYNAMIC_STATE_PRIMITIVE_RESTART_ENABLE,
+                VK_DYNAMIC_STATE_RASTERIZER_DISCARD_ENABLE,
+                VK_DYNAMIC_STATE_CULL_MODE,
+                VK_DYNAMIC_STATE_FRONT_FACE,
+                VK_DYNAMIC_STATE_POLYGON_MODE_EXT,
+                VK_DYNAMIC_STATE_DEPTH_BIAS_ENABLE,
+                VK_DYNAMIC_STATE_LINE_WIDTH,
+                VK_DYNAMIC_STATE_RASTERIZATION_SAMPLES_EXT,
+                VK_DYNAMIC_STATE_SAMPLE_MASK_EXT,
+                VK_DYNAMIC_STATE_ALPHA_TO_COVERAGE_ENABLE_EXT,
+                VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE,
+                VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE,
+                VK_DYNAMIC_STATE_DEPTH_COMPARE_OP,
+                VK_DYNAMIC_STATE_STENCIL_TEST_ENABLE,
+                VK_DYNAMIC_STATE_COLOR_BLEND_ENABLE_EXT,
+                VK_DYNAMIC_STATE_COLOR_BLEND_EQUATION_EXT,
+                VK_DYNAMIC_STATE_COLOR_WRITE_MASK_EXT
+            }
+        );
+
+        return dynamic_states;
+    }
+
+    // Topology stays static, only its class could be dynamic. Depth bias,
+    // primitive restart and rasterizer discard are fixed by materials so
+    // extended dynamic state 2 has nothing to offer.
+    if ( device.GetHasExtendedDynamicState( ) ) {
+        dynamic_states.emplace_back( VK_DYNAMIC_STATE_CULL_MODE );
+        dynamic_states.emplace_back( VK_DYNAMIC_STATE_FRONT_FACE );
+        dynamic_states.emplace_back( VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE );
+        dynamic_states.emplace_back( VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE );
+        dynamic_states.emplace_back( VK_DYNAMIC_STATE_DEPTH_COMPARE_OP );
+    }
+
+    if ( device.GetHasExtendedDynamicState3( ) ) {
+        dynamic_states.emplace_back( VK_DYNAMIC_STATE_POLYGON_MODE_EXT );
+        dynamic_states.emplace_back( VK_DYNAMIC_STATE_COLOR_BLEND_ENABLE_EXT );
+        dynamic_states.emplace_back( VK_DYNAMIC_STATE_COLOR_BLEND_EQUATION_EXT );
+        dynamic_states.emplace_back( VK_DYNAMIC_STATE_COLOR_WRITE_MASK_EXT );
+    }
+
     return dynamic_states;
 }
 
+vk::DynamicStateSpecification MicroMaterial::CreateDynamicSpec(
+    const MicroMaterialSpecification& specification
+) {
+    auto dynamic_spec    = vk::DynamicStateSpecification{ };
+    auto blend_count     = specification.Blends.size( );
+    auto binding_count   = specification.Bindings.size( );
+    auto attribute_count = specification.Attributes.size( );
+
+    dynamic_spec.Topology     = specification.Topology;
+    dynamic_spec.Samples      = specification.Samples;
+    dynamic_spec.CullMode     = specification.CullMode;
+    dynamic_spec.FrontFace    = specification.FrontFace;
+    dynamic_spec.DepthTest    = specification.DepthTest;
+    dynamic_spec.DepthWrite   = specification.DepthWrite;
+    dynamic_spec.DepthCompare = specification.DepthCompare;
+    dynamic_spec.PolygonMode  = specification.PolygonMode;
+
+    dynamic_spec.BlendEnables.resize( blend_count );
+    dynamic_spec.BlendEquations.resize( blend_count );
+    dynamic_spec.WriteMasks.resize( blend_count );
+
+    while ( blend_count-- > 0 ) {
+        auto& blend    = specification.Blends[ blend_count ];
+        auto& equation = dynamic_spec.BlendEquations[ blend_count ];
+
+        equation.srcColorBlendFactor = blend.srcColorBlendFactor;
+        equation.dstColorBlendFactor = blend.dstColorBlendFactor;
+        equation.colorBlendOp        = blend.colorBlendOp;
+        equation.srcAlphaBlendFactor = blend.srcAlphaBlendFactor;
+        equation.dstAlphaBlendFactor = blend.dstAlphaBlendFactor;
+        equation.alphaBlendOp        = blend.alphaBlendOp;
+
+        dynamic_spec.BlendEnables[ blend_count ] = blend.blendEnable;
+        dynamic_spec.WriteMasks[ blend_count ]   = blend.colorWriteMask;
+    }
+
+    dynamic_spec.VertexBindings.resize( binding_count );
+    dynamic_spec.VertexAttributes.resize( attribute_count );
+
+    while ( binding_count-- > 0 ) {
+        auto& binding      = specification.Bindings[ binding_count ];
+        auto& binding_spec = dynamic_spec.VertexBindings[ binding_count ];
+
+        binding_spec.sType     = VK_STRUCTURE_TYPE_VERTEX_INPUT_BINDING_DESCRIPTION_2_EXT;
+        binding_spec.pNext     = VK_NULL_HANDLE;
+        binding_spec.binding   = binding.binding;
+        binding_spec.stride    = binding.stride;
+        binding_spec.inputRate = binding.inputRate;
+        binding_spec.divisor   = 1;
+    }
+
+    while ( attribute_count-- > 0 ) {
+        auto& attribute      = specification.Attributes[ attribute_count ];
+        auto& attribute_spec = dynamic_spec.VertexAttributes[ attribute_count ];
+
+        attribute_spec.sType    = VK_STRUCTURE_TYPE_VERTEX_INPUT_ATTRIBUTE_DESCRIPTION_2_EXT;
+        attribute_spec.pNext    = VK_NULL_HANDLE;
+        attribute_spec.location = attribute.location;
+        attribute_spec.binding  = attribute.binding;
+        attribute_spec.format   = attribute.format;
+        attribute_spec.offset   = attribute.offset;
+    }
+
+    return dynamic_spec;
+}
+
 VkPipelineDynamicStateCreateInfo MicroMaterial::CreateDynamicStateSpec(
     const std::vector<VkDynamicState>& dynamic_states
 ) {
@@ -181,6 +628,125 @@ VkPipelineDynamicStateCreateInfo MicroMaterial::CreateDynamicStateSpec(
     return dynamic_state_spec;
 }
 
+VkPipelineVertexInputStateCreateInfo MicroMaterial::CreateVertexInputSpec(
+    const MicroMaterialSpecification& specification
+) {
+    auto vertex_spec = VkPipelineVertexInputStateCreateInfo{ };
+
+    vertex_spec.sType                           = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+    vertex_spec.pNext                           = VK_NULL_HANDLE;
+    vertex_spec.flags                           = VK_UNUSED_FLAG;
+    vertex_spec.vertexBindingDescriptionCount   = (uint32_t)specification.Bindings.size( );
+    vertex_spec.pVertexBindingDescriptions      = specification.Bindings.data( );
+    vertex_spec.vertexAttributeDescriptionCount = (uint32_t)specification.Attributes.size( );
+    vertex_spec.pVertexAttributeDescriptions    = specification.Attributes.data( );
+
+    return vertex_spec;
+}
+
+VkPipelineInputAssemblyStateCreateInfo MicroMaterial::CreateInputAssemblySpec(
+    const MicroMaterialSpecification& specification
+) {
+    auto assembly_spec = VkPipelineInputAssemblyStateCreateInfo{ };
+
+    assembly_spec.sType                  = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+    assembly_spec.pNext                  = VK_NULL_HANDLE;
+    assembly_spec.flags                  = VK_UNUSED_FLAG;
+    assembly_spec.topology               = specification.Topology;
+    assembly_spec.primitiveRestartEnable = VK_FALSE;
+
+    return assembly_spec;
+}
+
+VkPipelineViewportStateCreateInfo MicroMaterial::CreateViewportSpec( ) {
+    auto viewport_spec = VkPipelineViewportStateCreateInfo{ };
+
+    viewport_spec.sType         = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+    viewport_spec.pNext         = VK_NULL_HANDLE;
+    viewport_spec.flags         = VK_UNUSED_FLAG;
+    viewport_spec.viewportCount = 1;
+    viewport_spec.pViewports    = VK_NULL_HANDLE;
+    viewport_spec.scissorCount  = 1;
+    viewport_spec.pScissors     = VK_NULL_HANDLE;
+
+    return viewport_spec;
+}
+
+VkPipelineRasterizationStateCreateInfo MicroMaterial::CreateRasterizationSpec(
+    const MicroMaterialSpecification& specification
+) {
+    auto raster_spec = VkPipelineRasterizationStateCreateInfo{ };
+
+    raster_spec.sType                   = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+    raster_spec.pNext                   = VK_NULL_HANDLE;
+    raster_spec.flags                   = VK_UNUSED_FLAG;
+    raster_spec.depthClampEnable        = VK_FALSE;
+    raster_spec.rasterizerDiscardEnable = VK_FALSE;
+    raster_spec.polygonMode             = specification.PolygonMode;
+    raster_spec.cullMode                = specification.CullMode;
+    raster_spec.frontFace               = specification.FrontFace;
+    raster_spec.depthBiasEnable         = VK_FALSE;
+    raster_spec.depthBiasConstantFactor = 0.f;
+    raster_spec.depthBiasClamp          = 0.f;
+    raster_spec.depthBiasSlopeFactor    = 0.f;
+    raster_spec.lineWidth               = 1.f;
+
+    return raster_spec;
+}
+
+VkPipelineMultisampleStateCreateInfo MicroMaterial::CreateMultisampleSpec(
+    const MicroMaterialSpecification& specification
+) {
+    auto multisample_spec = VkPipelineMultisampleStateCreateInfo{ };
+
+    multisample_spec.sType                 = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+    multisample_spec.pNext                 = VK_NULL_HANDLE;
+    multisample_spec.flags                 = VK_UNUSED_FLAG;
+    multisample_spec.rasterizationSamples  = specification.Samples;
+    multisample_spec.sampleShadingEnable   = VK_FALSE;
+    multisample_spec.minSampleShading      = 1.f;
+    multisample_spec.pSampleMask           = VK_NULL_HANDLE;
+    multisample_spec.alphaToCoverageEnable = VK_FALSE;
+    multisample_spec.alphaToOneEnable      = VK_FALSE;
+
+    return multisample_spec;
+}
+
+VkPipelineDepthStencilStateCreateInfo MicroMaterial::CreateDepthStencilSpec(
+    const MicroMaterialSpecification& specification
+) {
+    auto depth_spec = VkPipelineDepthStencilStateCreateInfo{ };
+
+    depth_spec.sType                 = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+    depth_spec.pNext                 = VK_NULL_HANDLE;
+    depth_spec.flags                 = VK_UNUSED_FLAG;
+    depth_spec.depthTestEnable       = specification.DepthTest;
+    depth_spec.depthWriteEnable      = specification.DepthWrite;
+    depth_spec.depthCompareOp        = specification.DepthCompare;
+    depth_spec.depthBoundsTestEnable = VK_FALSE;
+    depth_spec.stencilTestEnable     = VK_FALSE;
+    depth_spec.minDepthBounds        = 0.f;
+    depth_spec.maxDepthBounds        = 1.f;
+
+    return depth_spec;
+}
+
+VkPipelineColorBlendStateCreateInfo MicroMaterial::CreateColorBlendSpec(
+    const MicroMaterialSpecification& specification
+) {
+    auto blend_spec = VkPipelineColorBlendStateCreateInfo{ };
+
+    blend_spec.sType           = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+    blend_spec.pNext           = VK_NULL_HANDLE;
+    blend_spec.flags           = VK_UNUSED_FLAG;
+    blend_spec.logicOpEnable   = VK_FALSE;
+    blend_spec.logicOp         = VK_LOGIC_OP_COPY;
+    blend_spec.attachmentCount = (uint32_t)specification.Blends.size( );
+    blend_spec.pAttachments    = specification.Blends.data( );
+
+    return blend_spec;
+}
+
 VkGraphicsPipelineCreateInfo MicroMaterial::CreatePipelineSpec(
     const MicroVulkanRenderPasses& passes,
     const MicroMaterialSpecification& specification
@@ -199,42 +765,374 @@ VkGraphicsPipelineCreateInfo MicroMaterial::CreatePipelineSpec(
     return pipeline_spec;
 }
 
+bool MicroMaterial::CreateLibrary(
+    const MicroVulkanDevice& device,
+    MicroVulkanPipelines& pipelines,
+    MicroVulkanPipelineRegistry& registry,
+    const uint64_t library_hash,
+    const VkGraphicsPipelineLibraryFlagBitsEXT part,
+    const std::vector<VkPipelineShaderStageCreateInfo>& stages,
+    const VkGraphicsPipelineCreateInfo& pipeline_spec
+) {
+    auto library = VkPipeline{ VK_NULL_HANDLE };
+
+    if ( !registry.Acquire( library_hash, library ) ) {
+        auto library_spec = VkGraphicsPipelineLibraryCreateInfoEXT{ };
+        auto part_spec    = pipeline_spec;
+
+        library_spec.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT;
+        library_spec.pNext = VK_NULL_HANDLE;
+        library_spec.flags = part;
+
+        part_spec.pNext      = micro_ptr( library_spec );
+        part_spec.flags      = VK_PIPELINE_CREATE_LIBRARY_BIT_KHR;
+        part_spec.stageCount = (uint32_t)stages.size( );
+        part_spec.pStages    = stages.data( );
+
+        if ( vk::CreatePipeline( device, pipelines.GetCache( ), part_spec, library ) != VK_SUCCESS )
+            return false;
+
+        registry.Register( device, library_hash, library );
+    }
+
+    m_libraries.emplace_back( library );
+
+    return true;
+}
+
+VkResult MicroMaterial::CreateLibraries(
+    const MicroVulkanDevice& device,
+    MicroVulkanPipelines& pipelines,
+    MicroVulkanPipelineRegistry& registry,
+    MicroVulkanShaderRegistry& shaders,
+    const MicroMaterialSpecification& specification,
+    const uint64_t layout_hash,
+    const VkGraphicsPipelineCreateInfo& pipeline_spec,
+    std::vector<VkPipelineShaderStageCreateInfo>& stages,
+    VkPipeline& pipeline
+) {
+    auto raster_stages   = std::vector<VkPipelineShaderStageCreateInfo>{ };
+    auto fragment_stages = std::vector<VkPipelineShaderStageCreateInfo>{ };
+    auto input_hash      = CreatePartHash( shaders, specification, layout_hash, VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT );
+    auto raster_hash     = CreatePartHash( shaders, specification, layout_hash, VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT );
+    auto fragment_hash   = CreatePartHash( shaders, specification, layout_hash, VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT );
+    auto output_hash     = CreatePartHash( shaders, specification, layout_hash, VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT );
+
+    if ( !CreateStageModules( device, shaders, specification, stages ) )
+        return VK_ERROR_INITIALIZATION_FAILED;
+
+    for ( auto& stage : stages ) {
+        if ( stage.stage == VK_SHADER_STAGE_FRAGMENT_BIT )
+            fragment_stages.emplace_back( stage );
+        else
+            raster_stages.emplace_back( stage );
+    }
+
+    // Each part is compiled once and shared through the registry, a new
+    // combination of parts only pays for the link.
+    if (
+        !CreateLibrary( device, pipelines, registry, input_hash, VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT, { }, pipeline_spec )                  ||
+        !CreateLibrary( device, pipelines, registry, raster_hash, VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT, raster_stages, pipeline_spec )    ||
+        !CreateLibrary( device, pipelines, registry, fragment_hash, VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT, fragment_stages, pipeline_spec )          ||
+        !CreateLibrary( device, pipelines, registry, output_hash, VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT, { }, pipeline_spec )
+    )
+        return VK_ERROR_INITIALIZATION_FAILED;
+
+    auto library_spec = VkPipelineLibraryCreateInfoKHR{ };
+    auto link_spec    = pipeline_spec;
+
+    library_spec.sType        = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR;
+    library_spec.pNext        = VK_NULL_HANDLE;
+    library_spec.libraryCount = (uint32_t)m_libraries.size( );
+    library_spec.pLibraries   = m_libraries.data( );
+
+    // Link time optimization is left out on purpose, the fast link is what
+    // keeps new materials from stalling the frame.
+    link_spec.pNext      = micro_ptr( library_spec );
+    link_spec.flags      = VK_UNUSED_FLAG;
+    link_spec.stageCount = 0;
+    link_spec.pStages    = VK_NULL_HANDLE;
+
+    return vk::CreatePipeline( device, pipelines.GetCache( ), link_spec, pipeline );
+}
+
 bool MicroMaterial::CreatePipeline(
     const MicroVulkanDevice& device,
-    const MicroVulkanPipelines& pipelines,
+    MicroVulkanPipelines& pipelines,
+    MicroVulkanPipelineRegistry& registry,
+    MicroVulkanShaderRegistry& shaders,
     const MicroVulkanRenderPasses& passes,
-    const MicroMaterialSpecification& specification
+    const MicroMaterialSpecification& specification,
+    const uint64_t layout_hash,
+    VkPipeline& pipeline
 ) {
-    auto can_create   = true;
-    auto pipeline_spec = CreatePipelineSpec( passes, specification );
-    auto dynamic_states = CreateDynamicStates( );
+    auto pipeline_hash = CreatePipelineHash( shaders, specification, layout_hash );
 
-    auto stages_spec = CreatePipelineStagesSpec( device, specification, can_create );
-    auto dynamic_state_spec = CreateDynamicStateSpec( dynamic_states );
+    if ( registry.Acquire( pipeline_hash, pipeline ) )
+        return true;
 
-    pipeline_spec.stageCount    = (uint32_t)stages_spec.size( );
-    pipeline_spec.pStages       = stages_spec.data( );
-    pipeline_spec.pVertexInputState = nullptr;
-    pipeline_spec.pInputAssemblyState = nullptr;
-    pipeline_spec.pTessellationState = nullptr;
-    pipeline_spec.pViewportState = nullptr;
-    pipeline_spec.pRasterizationState = nullptr;
-    pipeline_spec.pMultisampleState = nullptr;
-    pipeline_spec.pDepthStencilState = nullptr;
-    pipeline_spec.pColorBlendState = nullptr;
-    pipeline_spec.pDynamicState = micro_ptr( dynamic_state_spec );
+    auto identifiers        = std::vector<VkPipelineShaderStageModuleIdentifierCreateInfoEXT>{ };
+    auto identifier_data    = std::vector<std::vector<uint8_t>>{ };
+    auto specializations    = std::vector<VkSpecializationInfo>{ };
+    auto result             = VK_PIPELINE_COMPILE_REQUIRED;
+    auto pipeline_spec      = CreatePipelineSpec( passes, specification );
+    auto stages_spec        = CreatePipelineStagesSpec( specification, specializations );
+    auto vertex_spec        = CreateVertexInputSpec( specification );
+    auto assembly_spec      = CreateInputAssemblySpec( specification );
+    auto viewport_spec      = CreateViewportSpec( );
+    auto raster_spec        = CreateRasterizationSpec( specification );
+    auto multisample_spec   = CreateMultisampleSpec( specification );
+    auto depth_spec         = CreateDepthStencilSpec( specification );
+    auto blend_spec         = CreateColorBlendSpec( specification );
+    auto dynamic_state_spec = CreateDynamicStateSpec( m_dynamic_states );
 
-    can_create = can_create && vk::CreatePipeline( device, pipelines.GetCache( ), pipeline_spec, m_pipeline ) == VK_SUCCESS;
+    pipeline_spec.stageCount          = (uint32_t)stages_spec.size( );
+    pipeline_spec.pStages             = stages_spec.data( );
+    pipeline_spec.pVertexInputState   = micro_ptr( vertex_spec );
+    pipeline_spec.pInputAssemblyState = micro_ptr( assembly_spec );
+    pipeline_spec.pTessellationState  = VK_NULL_HANDLE;
+    pipeline_spec.pViewportState      = micro_ptr( viewport_spec );
+    pipeline_spec.pRasterizationState = micro_ptr( raster_spec );
+    pipeline_spec.pMultisampleState   = micro_ptr( multisample_spec );
+    pipeline_spec.pDepthStencilState  = micro_ptr( depth_spec );
+    pipeline_spec.pColorBlendState    = micro_ptr( blend_spec );
+    pipeline_spec.pDynamicState       = micro_ptr( dynamic_state_spec );
 
-    DestroyShaders( device, stages_spec );
+    // Graphics pipeline libraries take precedence, otherwise with shader
+    // module identifiers a pipeline already in the cache is created without
+    // any SPIR-V, modules are only built when the driver reports that it
+    // has to compile.
+    if ( device.GetHasGraphicsPipelineLibrary( ) )
+        result = CreateLibraries( device, pipelines, registry, shaders, specification, layout_hash, pipeline_spec, stages_spec, pipeline );
+    else if ( CreateStageIdentifiers( device, shaders, specification, stages_spec, identifiers, identifier_data ) ) {
+        pipeline_spec.flags = VK_PIPELINE_CREATE_FAIL_ON_PIPELINE_COMPILE_REQUIRED_BIT;
+
+        result = vk::CreatePipeline( device, pipelines.GetCache( ), pipeline_spec, pipeline );
+    }
+
+    if ( result == VK_PIPELINE_COMPILE_REQUIRED ) {
+        pipeline_spec.flags = VK_UNUSED_FLAG;
+
+        if ( CreateStageModules( device, shaders, specification, stages_spec ) )
+            result = vk::CreatePipeline( device, pipelines.GetCache( ), pipeline_spec, pipeline );
+    }
+
+    auto can_create = result == VK_SUCCESS;
+
+    if ( can_create ) {
+        auto entry = std::vector<uint8_t>{ };
+
+        if ( CreateManifestEntry( registry, specification, entry ) )
+            pipelines.Record( std::move( entry ) );
+
+        registry.Register( device, pipeline_hash, pipeline );
+        pipelines.Notify( );
+    }
 
     return can_create;
 }
 
-void MicroMaterial::DestroyShaders(
+bool MicroMaterial::CreateShaderObject(
     const MicroVulkanDevice& device,
-    std::vector<VkPipelineShaderStageCreateInfo>& stages
+    MicroVulkanPipelineRegistry& registry,
+    MicroVulkanShaderRegistry& shaders,
+    const MicroShaderSpecification& shader_spec,
+    const std::vector<VkDescriptorSetLayout>& layouts,
+    const VkShaderStageFlags next_stage,
+    const uint64_t layout_hash,
+    VkShaderEXT& shader
 ) {
-    for ( auto& stage : stages )
-        vk::DestroyShader( device, stage.module );
+    auto hash = MicroVulkanHash{ };
+
+    hash.Combine( shader_spec.Stage );
+    hash.Combine( next_stage );
+    hash.Combine( shader_spec.Name );
+    hash.Combine( shaders.CreateHash( shader_spec.Code ) );
+    hash.Combine( shader_spec.Entries );
+    hash.Combine( shader_spec.Constants );
+    hash.Combine( layout_hash );
+
+    if ( registry.Acquire( hash, shader ) )
+        return true;
+
+    auto specialization = shader_spec.GetSpecialization( );
+    auto object_spec    = VkShaderCreateInfoEXT{ };
+
+    object_spec.sType                  = VK_STRUCTURE_TYPE_SHADER_CREATE_INFO_EXT;
+    object_spec.pNext                  = VK_NULL_HANDLE;
+    object_spec.flags                  = VK_UNUSED_FLAG;
+    object_spec.stage                  = shader_spec.Stage;
+    object_spec.nextStage              = next_stage;
+    object_spec.codeType               = VK_SHADER_CODE_TYPE_SPIRV_EXT;
+    object_spec.codeSize               = shader_spec.Code.size( ) * sizeof( uint32_t );
+    object_spec.pCode                  = shader_spec.Code.data( );
+    object_spec.pName                  = shader_spec.Name.c_str( );
+    object_spec.setLayoutCount         = (uint32_t)layouts.size( );
+    object_spec.pSetLayouts            = layouts.data( );
+    object_spec.pushConstantRangeCount = (uint32_t)m_push_constants.size( );
+    object_spec.pPushConstantRanges    = m_push_constants.data( );
+    object_spec.pSpecializationInfo    = VK_NULL_HANDLE;
+
+    if ( specialization.mapEntryCount > 0 )
+        object_spec.pSpecializationInfo = micro_ptr( specialization );
+
+    if ( vk::CreateShaderObject( device, object_spec, shader ) != VK_SUCCESS )
+        return false;
+
+    registry.Register( device, hash, shader );
+
+    return true;
+}
+
+bool MicroMaterial::CreateShaderObjects(
+    const MicroVulkanDevice& device,
+    MicroVulkanPipelineRegistry& registry,
+    MicroVulkanShaderRegistry& shaders,
+    const MicroVulkanBindless& bindless,
+    const MicroMaterialSpecification& specification,
+    const uint64_t layout_hash
+) {
+    auto layouts      = std::vector<VkDescriptorSetLayout>{ };
+    auto stages       = std::vector<VkShaderStageFlagBits>{ VK_SHADER_STAGE_VERTEX_BIT, VK_SHADER_STAGE_FRAGMENT_BIT };
+    auto objects      = std::vector<VkShaderEXT>( stages.size( ), VK_NULL_HANDLE );
+    auto has_fragment = false;
+
+    if ( specification.Bindless )
+        layouts.emplace_back( bindless.GetLayout( ) );
+
+    layouts.insert( layouts.end( ), m_set_layouts.begin( ), m_set_layouts.end( ) );
+
+    for ( auto& shader : specification.Shaders )
+        has_fragment |= shader.Stage == VK_SHADER_STAGE_FRAGMENT_BIT;
+
+    // Objects are created unlinked so materials sharing a stage share its
+    // object. Tessellation and geometry features are never enabled, only
+    // the vertex and fragment stages are bound, with null when unused.
+    for ( auto& shader : specification.Shaders ) {
+        auto is_vertex  = shader.Stage == VK_SHADER_STAGE_VERTEX_BIT;
+        auto next_stage = ( is_vertex && has_fragment ) ? (VkShaderStageFlags)VK_SHADER_STAGE_FRAGMENT_BIT : (VkShaderStageFlags)0;
+        auto& object    = objects[ is_vertex ? 0 : 1 ];
+
+        micro_assert( is_vertex || shader.Stage == VK_SHADER_STAGE_FRAGMENT_BIT, "Shader object materials only support Vertex & Fragment shaders" );
+
+        if ( CreateShaderObject( device, registry, shaders, shader, layouts, next_stage, layout_hash, object ) )
+            continue;
+
+        for ( auto& created : objects )
+            registry.Release( device, created );
+
+        return false;
+    }
+
+    m_shader_stages  = std::move( stages );
+    m_shader_objects = std::move( objects );
+
+    return true;
+}
+
+bool MicroMaterial::CreateManifestEntry(
+    const MicroVulkanPipelineRegistry& registry,
+    const MicroMaterialSpecification& specification,
+    std::vector<uint8_t>& entry
+) {
+    auto blob = MicroVulkanBlob{ };
+
+    blob.Write( specification.RenderPass );
+    blob.Write( specification.Subpass );
+    blob.Write( (uint32_t)specification.Shaders.size( ) );
+
+    for ( auto& shader : specification.Shaders ) {
+        blob.Write( shader.Stage );
+        blob.Write( shader.Name );
+        blob.Write( shader.Code );
+        blob.Write( shader.Entries );
+        blob.Write( shader.Constants );
+    }
+
+    blob.Write( specification.Bindings );
+    blob.Write( specification.Attributes );
+    blob.Write( specification.Topology );
+    blob.Write( specification.PolygonMode );
+    blob.Write( specification.CullMode );
+    blob.Write( specification.FrontFace );
+    blob.Write( specification.Samples );
+    blob.Write( specification.DepthTest );
+    blob.Write( specification.DepthWrite );
+    blob.Write( specification.DepthCompare );
+    blob.Write( specification.Blends );
+    blob.Write( specification.Bindless );
+    blob.Write( (uint32_t)specification.Layouts.size( ) );
+
+    // Set layouts are only known by handle, the registry keeps the bindings
+    // of the ones it created. Immutable samplers can't outlive the process.
+    for ( auto& layout : specification.Layouts ) {
+        auto bindings = std::vector<VkDescriptorSetLayoutBinding>{ };
+
+        if ( !registry.GetBindings( layout, bindings ) )
+            return false;
+
+        for ( auto& binding : bindings ) {
+            if ( binding.pImmutableSamplers != VK_NULL_HANDLE )
+                return false;
+        }
+
+        blob.Write( bindings );
+    }
+
+    blob.Write( specification.PushConstants );
+
+    entry = std::move( blob.Get( ) );
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool MicroMaterial::GetIsReady( ) const {
+    return  !m_pending.valid( ) ||
+            m_pending.wait_for( std::chrono::seconds( 0 ) ) == std::future_status::ready;
+}
+
+bool MicroMaterial::GetIsValid( ) {
+    if ( !GetIsReady( ) )
+        return false;
+
+    GetPipeline( );
+
+    return vk::IsValid( m_pipeline ) || !m_shader_objects.empty( );
+}
+
+VkPipeline MicroMaterial::GetPipeline( ) {
+    if ( m_pending.valid( ) && GetIsReady( ) ) {
+        m_pipeline = m_pending.get( );
+        m_pending  = { };
+    }
+
+    return vk::IsValid( m_pipeline ) ? m_pipeline : m_placeholder;
+}
+
+VkPipelineLayout MicroMaterial::GetLayout( ) const {
+    return m_layout;
+}
+
+const std::vector<VkDescriptorSet>& MicroMaterial::GetDescriptors( ) const {
+    return m_descriptors;
+}
+
+const std::vector<VkDescriptorSetLayout>& MicroMaterial::GetSetLayouts( ) const {
+    return m_set_layouts;
+}
+
+const std::vector<VkPushConstantRange>& MicroMaterial::GetPushConstants( ) const {
+    return m_push_constants;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool MicroMaterial::GetIsDynamic( const VkDynamicState dynamic_state ) const {
+    auto iterator = std::find( m_dynamic_states.begin( ), m_dynamic_states.end( ), dynamic_state );
+
+    return iterator != m_dynamic_states.end( );
 }
@@ -37,9 +37,20 @@ micro_class MicroMaterial {
 
 private:
 	VkPipeline m_pipeline;
+	VkPipeline m_placeholder;
 	VkPipelineLayout m_layout;
-	VkDescriptorPool m_pool;
+	std::shared_future<VkPipeline> m_pending;
+	std::vector<VkShaderModule> m_shaders;
 	std::vector<VkDescriptorSet> m_descriptors;
+	std::vector<VkDescriptorSetLayout> m_set_layouts;
+	std::vector<VkPushConstantRange> m_push_constants;
+	std::vector<VkDynamicState> m_dynamic_states;
+	vk::DynamicStateSpecification m_dynamic;
+	std::vector<VkPipeline> m_libraries;
+	std::vector<VkShaderStageFlagBits> m_shader_stages;
+	std::vector<VkShaderEXT> m_shader_objects;
+	uint32_t m_set_offset;
+	bool m_is_reflected;
 
 public:
 	MicroMaterial( );
@@ -47,63 +58,216 @@ public:
 	~MicroMaterial( ) = default;
 	
 	bool Create( 
-		const MicroVulkan& vulkan,
+		MicroVulkan& vulkan,
 		const MicroMaterialSpecification& specification
 	);
 
-	void Destroy( const MicroVulkan& vulkan );
+	std::shared_future<VkPipeline> Create(
+		MicroVulkan& vulkan,
+		MicroVulkanWorkerPool& workers,
+		const MicroMaterialSpecification& specification,
+		const VkPipeline placeholder
+	);
+
+	void Destroy( MicroVulkan& vulkan );
+
+	/**
+	 * Swap function
+	 * @note : Exchange the compiled program with another ready material that
+	 *		   shares the same pipeline layout. Descriptors stay in place, so
+	 *		   writes already made to this material survive the exchange.
+	 * @param other : Query material, receives the previous program.
+	 * @return bool
+	 **/
+	bool Swap( MicroMaterial& other );
+
+	void CmdBind( const VkCommandBuffer& commands );
+
+	void CmdPushConstants(
+		const VkCommandBuffer& commands,
+		const VkShaderStageFlags stages,
+		const uint32_t offset,
+		const uint32_t length,
+		const void* data
+	);
 
 private:
-	bool CreateLayout(
-		const MicroVulkanDevice& device
+	uint64_t CreatePartHash(
+		const MicroVulkanShaderRegistry& shaders,
+		const MicroMaterialSpecification& specification,
+		const uint64_t layout_hash,
+		const VkGraphicsPipelineLibraryFlagBitsEXT part
 	);
 
-	bool CreateDescriporPool(
-		const MicroVulkanDevice& device
+	uint64_t CreatePipelineHash(
+		const MicroVulkanShaderRegistry& shaders,
+		const MicroMaterialSpecification& specification,
+		const uint64_t layout_hash
 	);
 
-	bool CreateDescriptors(
-		const MicroVulkanDevice& device
+	bool CreateReflection(
+		const MicroVulkanDevice& device,
+		MicroVulkanPipelineRegistry& registry,
+		const MicroMaterialSpecification& specification
+	);
+
+	bool CreateLayout(
+		const MicroVulkanDevice& device,
+		MicroVulkanPipelineRegistry& registry,
+		const MicroVulkanBindless& bindless,
+		const MicroMaterialSpecification& specification,
+		uint64_t& layout_hash
 	);
 
 	void CreateStageSpec(
 		const MicroShaderSpecification& shader_spec,
+		VkSpecializationInfo& specialization,
 		VkPipelineShaderStageCreateInfo& stage_spec
 	);
 
-	bool CreateShader(
+	std::vector<VkPipelineShaderStageCreateInfo> CreatePipelineStagesSpec(
+		const MicroMaterialSpecification& specification,
+		std::vector<VkSpecializationInfo>& specializations
+	);
+
+	bool CreateStageIdentifiers(
 		const MicroVulkanDevice& device,
-		const std::vector<uint32_t>& code,
-		VkShaderModule& shader
+		MicroVulkanShaderRegistry& shaders,
+		const MicroMaterialSpecification& specification,
+		std::vector<VkPipelineShaderStageCreateInfo>& stages,
+		std::vector<VkPipelineShaderStageModuleIdentifierCreateInfoEXT>& identifiers,
+		std::vector<std::vector<uint8_t>>& identifier_data
 	);
 
-	std::vector<VkPipelineShaderStageCreateInfo> CreatePipelineStagesSpec(
+	bool CreateStageModules(
 		const MicroVulkanDevice& device,
+		MicroVulkanShaderRegistry& shaders,
 		const MicroMaterialSpecification& specification,
-		bool& can_create
+		std::vector<VkPipelineShaderStageCreateInfo>& stages
 	);
 
-	virtual std::vector<VkDynamicState> CreateDynamicStates( );
+	virtual std::vector<VkDynamicState> CreateDynamicStates( const MicroVulkanDevice& device );
+
+	vk::DynamicStateSpecification CreateDynamicSpec(
+		const MicroMaterialSpecification& specification
+	);
 
 	VkPipelineDynamicStateCreateInfo CreateDynamicStateSpec( 
 		const std::vector<VkDynamicState>& dynamic_states
 	);
 
+	VkPipelineVertexInputStateCreateInfo CreateVertexInputSpec(
+		const MicroMaterialSpecification& specification
+	);
+
+	VkPipelineInputAssemblyStateCreateInfo CreateInputAssemblySpec(
+		const MicroMaterialSpecification& specification
+	);
+
+	VkPipelineViewportStateCreateInfo CreateViewportSpec( );
+
+	VkPipelineRasterizationStateCreateInfo CreateRasterizationSpec(
+		const MicroMaterialSpecification& specification
+	);
+
+	VkPipelineMultisampleStateCreateInfo CreateMultisampleSpec(
+		const MicroMaterialSpecification& specification
+	);
+
+	VkPipelineDepthStencilStateCreateInfo CreateDepthStencilSpec(
+		const MicroMaterialSpecification& specification
+	);
+
+	VkPipelineColorBlendStateCreateInfo CreateColorBlendSpec(
+		const MicroMaterialSpecification& specification
+	);
+
 	VkGraphicsPipelineCreateInfo CreatePipelineSpec(
 		const MicroVulkanRenderPasses& passes,
 		const MicroMaterialSpecification& specification
 	);
 
+	bool CreateLibrary(
+		const MicroVulkanDevice& device,
+		MicroVulkanPipelines& pipelines,
+		MicroVulkanPipelineRegistry& registry,
+		const uint64_t library_hash,
+		const VkGraphicsPipelineLibraryFlagBitsEXT part,
+		const std::vector<VkPipelineShaderStageCreateInfo>& stages,
+		const VkGraphicsPipelineCreateInfo& pipeline_spec
+	);
+
+	VkResult CreateLibraries(
+		const MicroVulkanDevice& device,
+		MicroVulkanPipelines& pipelines,
+		MicroVulkanPipelineRegistry& registry,
+		MicroVulkanShaderRegistry& shaders,
+		const MicroMaterialSpecification& specification,
+		const uint64_t layout_hash,
+		const VkGraphicsPipelineCreateInfo& pipeline_spec,
+		std::vector<VkPipelineShaderStageCreateInfo>& stages,
+		VkPipeline& pipeline
+	);
+
 	bool CreatePipeline(
 		const MicroVulkanDevice& device,
-		const MicroVulkanPipelines& pipelines,
+		MicroVulkanPipelines& pipelines,
+		MicroVulkanPipelineRegistry& registry,
+		MicroVulkanShaderRegistry& shaders,
 		const MicroVulkanRenderPasses& passes,
-		const MicroMaterialSpecification& specification
+		const MicroMaterialSpecification& specification,
+		const uint64_t layout_hash,
+		VkPipeline& pipeline
 	);
 
-	void DestroyShaders(
+	bool CreateShaderObject(
 		const MicroVulkanDevice& device,
-		std::vector<VkPipelineShaderStageCreateInfo>& stages
+		MicroVulkanPipelineRegistry& registry,
+		MicroVulkanShaderRegistry& shaders,
+		const MicroShaderSpecification& shader_spec,
+		const std::vector<VkDescriptorSetLayout>& layouts,
+		const VkShaderStageFlags next_stage,
+		const uint64_t layout_hash,
+		VkShaderEXT& shader
+	);
+
+	bool CreateShaderObjects(
+		const MicroVulkanDevice& device,
+		MicroVulkanPipelineRegistry& registry,
+		MicroVulkanShaderRegistry& shaders,
+		const MicroVulkanBindless& bindless,
+		const MicroMaterialSpecification& specification,
+		const uint64_t layout_hash
 	);
 
+	bool CreateManifestEntry(
+		const MicroVulkanPipelineRegistry& registry,
+		const MicroMaterialSpecification& specification,
+		std::vector<uint8_t>& entry
+	);
+
+public:
+	bool GetIsReady( ) const;
+
+	/**
+	 * GetIsValid function
+	 * @note : Shader object materials have no pipeline, the material is
+	 *		   valid once ready with either a pipeline or shader objects.
+	 * @return bool
+	 **/
+	bool GetIsValid( );
+
+	VkPipeline GetPipeline( );
+
+	VkPipelineLayout GetLayout( ) const;
+
+	const std::vector<VkDescriptorSet>& GetDescriptors( ) const;
+
+	const std::vector<VkDescriptorSetLayout>& GetSetLayouts( ) const;
+
+	const std::vector<VkPushConstantRange>& GetPushConstants( ) const;
+
+private:
+	bool GetIsDynamic( const VkDynamicState dynamic_state ) const;
+
 };
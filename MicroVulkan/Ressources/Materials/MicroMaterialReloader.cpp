@@ -0,0 +1,293 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "__micro_vulkan_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+MicroMaterialReloader::MicroMaterialReloader( )
+	: m_watcher{ },
+	m_sources{ },
+	m_pending{ },
+	m_retired{ },
+	m_errors{ }
+{ }
+
+bool MicroMaterialReloader::Create( const std::vector<std::string>& directories ) {
+	return m_watcher.Create( directories );
+}
+
+bool MicroMaterialReloader::Register(
+	MicroMaterial& material,
+	const MicroMaterialSpecification& specification,
+	const std::vector<MicroVulkanCompilerJob>& jobs
+) {
+	if ( jobs.size( ) != specification.Shaders.size( ) || GetSource( micro_ptr( material ) ) != nullptr )
+		return false;
+
+	auto& source = m_sources.emplace_back( );
+
+	source.Material		 = micro_ptr( material );
+	source.Specification = specification;
+	source.Jobs			 = jobs;
+
+	for ( auto& job : source.Jobs ) {
+		if ( !job.Path.empty( ) )
+			job.Path = MicroVulkanCompilerIncluder::CreatePath( job.Path );
+	}
+
+	return true;
+}
+
+void MicroMaterialReloader::Unregister( MicroVulkan& vulkan, const MicroMaterial& material ) {
+	auto pending_id = m_pending.size( );
+
+	while ( pending_id-- > 0 ) {
+		auto& pending = m_pending[ pending_id ];
+
+		if ( pending.Material != micro_ptr( material ) )
+			continue;
+
+		DestroyPending( vulkan, pending );
+
+		m_pending.erase( m_pending.begin( ) + pending_id );
+	}
+
+	std::erase_if( m_sources, [ &material ]( const auto& source ) { return source.Material == micro_ptr( material ); } );
+}
+
+void MicroMaterialReloader::Update(
+	MicroVulkan& vulkan,
+	MicroVulkanWorkerPool& workers,
+	MicroVulkanCompiler& compiler
+) {
+	m_errors.clear( );
+
+	DestroyRetired( vulkan );
+	CreateReloads( workers, compiler );
+
+	auto pending_id = m_pending.size( );
+
+	while ( pending_id-- > 0 ) {
+		auto& pending = m_pending[ pending_id ];
+		auto is_done  = pending.Reload ? SwapMaterial( vulkan, pending ) : CreateMaterial( vulkan, workers, pending );
+
+		if ( is_done )
+			m_pending.erase( m_pending.begin( ) + pending_id );
+	}
+}
+
+void MicroMaterialReloader::Destroy( MicroVulkan& vulkan ) {
+	for ( auto& pending : m_pending )
+		DestroyPending( vulkan, pending );
+
+	// Shutdown path, the caller is expected to have waited for the device.
+	for ( auto& retired : m_retired )
+		retired.Material->Destroy( vulkan );
+
+	m_watcher.Destroy( );
+	m_sources.clear( );
+	m_pending.clear( );
+	m_retired.clear( );
+	m_errors.clear( );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+void MicroMaterialReloader::DestroyRetired( MicroVulkan& vulkan ) {
+	auto retired_id = m_retired.size( );
+
+	while ( retired_id-- > 0 ) {
+		auto& retired = m_retired[ retired_id ];
+
+		if ( --retired.Frames > 0 )
+			continue;
+
+		retired.Material->Destroy( vulkan );
+
+		m_retired.erase( m_retired.begin( ) + retired_id );
+	}
+}
+
+void MicroMaterialReloader::DestroyPending( MicroVulkan& vulkan, MicroMaterialReloaderPending& pending ) {
+	// Reloads are never bound, Destroy waits for the worker still building
+	// them and releases everything right away.
+	if ( pending.Reload )
+		pending.Reload->Destroy( vulkan );
+
+	pending.Reload.reset( );
+}
+
+void MicroMaterialReloader::CreateReloads(
+	MicroVulkanWorkerPool& workers,
+	MicroVulkanCompiler& compiler
+) {
+	auto roots = std::set<std::string>{ };
+
+	// Every shader is recorded as its own dependency, an edited shader and
+	// an edited include resolve to the same roots.
+	for ( const auto& path : m_watcher.Poll( ) ) {
+		auto dependents = compiler.GetDependents( path );
+
+		roots.emplace( path );
+		roots.insert( dependents.begin( ), dependents.end( ) );
+	}
+
+	if ( roots.empty( ) )
+		return;
+
+	for ( const auto& source : m_sources ) {
+		auto is_affected = std::any_of(
+			source.Jobs.begin( ), source.Jobs.end( ),
+			[ &roots ]( const auto& job ) { return roots.contains( job.Path ); }
+		);
+
+		if ( is_affected )
+			CreateReload( workers, compiler, source );
+	}
+}
+
+void MicroMaterialReloader::CreateReload(
+	MicroVulkanWorkerPool& workers,
+	MicroVulkanCompiler& compiler,
+	const MicroMaterialReloaderSource& source
+) {
+	// Only the latest edit of a material gets swapped in, older reloads
+	// still in flight are dropped once they resolve.
+	for ( auto& pending : m_pending ) {
+		if ( pending.Material == source.Material )
+			pending.IsStale = true;
+	}
+
+	auto& pending = m_pending.emplace_back( );
+
+	pending.Material = source.Material;
+	pending.Results	 = compiler.Compile( workers, source.Jobs );
+	pending.Reload	 = { };
+	pending.IsStale	 = false;
+}
+
+bool MicroMaterialReloader::CreateMaterial(
+	MicroVulkan& vulkan,
+	MicroVulkanWorkerPool& workers,
+	MicroMaterialReloaderPending& pending
+) {
+	auto is_compiling = std::any_of(
+		pending.Results.begin( ), pending.Results.end( ),
+		[]( const auto& result ) { return result.wait_for( std::chrono::seconds( 0 ) ) != std::future_status::ready; }
+	);
+
+	if ( is_compiling )
+		return false;
+
+	if ( pending.IsStale )
+		return true;
+
+	auto* source	   = GetSource( pending.Material );
+	auto specification = source->Specification;
+	auto shader_id	   = pending.Results.size( );
+
+	while ( shader_id-- > 0 ) {
+		auto& result = pending.Results[ shader_id ].get( );
+		auto& code	 = specification.Shaders[ shader_id ].Code;
+
+		// A failed compile keeps the running program, the error is reported
+		// and the next save of the file retries.
+		if ( !result.GetIsValid( ) ) {
+			m_errors.emplace_back( result.Error );
+
+			return true;
+		}
+
+		code.resize( result.Output.size( ) / sizeof( uint32_t ) );
+
+		std::memcpy( code.data( ), result.Output.data( ), code.size( ) * sizeof( uint32_t ) );
+	}
+
+	// Descriptors and the layout are created here, the pipeline itself is
+	// built on a worker like any other asynchronous material.
+	pending.Reload = std::make_unique<MicroMaterial>( );
+
+	pending.Reload->Create( vulkan, workers, specification, VK_NULL_HANDLE );
+
+	return false;
+}
+
+bool MicroMaterialReloader::SwapMaterial(
+	MicroVulkan& vulkan,
+	MicroMaterialReloaderPending& pending
+) {
+	if ( !pending.Reload->GetIsReady( ) )
+		return false;
+
+	if ( pending.IsStale || !pending.Material->Swap( micro_ref( pending.Reload ) ) ) {
+		if ( !pending.IsStale )
+			m_errors.emplace_back( "Reloaded material could not be swapped, its pipeline failed or its layout changed." );
+
+		DestroyPending( vulkan, pending );
+
+		return true;
+	}
+
+	// The reload now owns the previous program, it may still be recorded in
+	// frames in flight until each frame slot has been acquired again.
+	auto& retired = m_retired.emplace_back( );
+
+	retired.Material = std::move( pending.Reload );
+	retired.Frames	 = vulkan.GetFrameCount( );
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool MicroMaterialReloader::GetIsValid( ) const {
+	return m_watcher.GetIsValid( );
+}
+
+const std::vector<std::string>& MicroMaterialReloader::GetErrors( ) const {
+	return m_errors;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+const MicroMaterialReloaderSource* MicroMaterialReloader::GetSource( const MicroMaterial* material ) const {
+	for ( const auto& source : m_sources ) {
+		if ( source.Material == material )
+			return micro_ptr( source );
+	}
+
+	return nullptr;
+}
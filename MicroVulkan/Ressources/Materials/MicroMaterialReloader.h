@@ -0,0 +1,145 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "../../Compiler/MicroVulkanCompilerPermutations.h"
+#include "MicroComputeMaterial.h"
+
+micro_struct MicroMaterialReloaderSource {
+
+	MicroMaterial* Material;
+	MicroMaterialSpecification Specification;
+	std::vector<MicroVulkanCompilerJob> Jobs;
+
+};
+
+micro_struct MicroMaterialReloaderPending {
+
+	MicroMaterial* Material;
+	std::vector<std::shared_future<MicroVulkanCompilerResult>> Results;
+	std::unique_ptr<MicroMaterial> Reload;
+	bool IsStale;
+
+};
+
+micro_struct MicroMaterialReloaderRetired {
+
+	std::unique_ptr<MicroMaterial> Material;
+	uint32_t Frames;
+
+};
+
+micro_class MicroMaterialReloader final {
+
+private:
+	MicroVulkanShaderWatcher m_watcher;
+	std::vector<MicroMaterialReloaderSource> m_sources;
+	std::vector<MicroMaterialReloaderPending> m_pending;
+	std::vector<MicroMaterialReloaderRetired> m_retired;
+	std::vector<std::string> m_errors;
+
+public:
+	MicroMaterialReloader( );
+
+	MicroMaterialReloader( const MicroMaterialReloader& ) = delete;
+
+	~MicroMaterialReloader( ) = default;
+
+	bool Create( const std::vector<std::string>& directories );
+
+	/**
+	 * Register function
+	 * @note : Jobs map one to one to the specification shaders, jobs with a
+	 *		   path are recompiled when the file or one of its includes change.
+	 * @param material : Query material, must outlive its registration.
+	 * @param specification : Query specification the material was created with.
+	 * @param jobs : Query compiler jobs of the specification shaders.
+	 * @return bool
+	 **/
+	bool Register(
+		MicroMaterial& material,
+		const MicroMaterialSpecification& specification,
+		const std::vector<MicroVulkanCompilerJob>& jobs
+	);
+
+	void Unregister( MicroVulkan& vulkan, const MicroMaterial& material );
+
+	/**
+	 * Update function
+	 * @note : Call once per frame after MicroVulkan::Acquire and before any
+	 *		   material is recorded, swapped programs are destroyed once every
+	 *		   frame that could have used them has been acquired again.
+	 **/
+	void Update(
+		MicroVulkan& vulkan,
+		MicroVulkanWorkerPool& workers,
+		MicroVulkanCompiler& compiler
+	);
+
+	void Destroy( MicroVulkan& vulkan );
+
+private:
+	void DestroyRetired( MicroVulkan& vulkan );
+
+	void DestroyPending( MicroVulkan& vulkan, MicroMaterialReloaderPending& pending );
+
+	void CreateReloads(
+		MicroVulkanWorkerPool& workers,
+		MicroVulkanCompiler& compiler
+	);
+
+	void CreateReload(
+		MicroVulkanWorkerPool& workers,
+		MicroVulkanCompiler& compiler,
+		const MicroMaterialReloaderSource& source
+	);
+
+	bool CreateMaterial(
+		MicroVulkan& vulkan,
+		MicroVulkanWorkerPool& workers,
+		MicroMaterialReloaderPending& pending
+	);
+
+	bool SwapMaterial(
+		MicroVulkan& vulkan,
+		MicroMaterialReloaderPending& pending
+	);
+
+public:
+	bool GetIsValid( ) const;
+
+	const std::vector<std::string>& GetErrors( ) const;
+
+private:
+	const MicroMaterialReloaderSource* GetSource( const MicroMaterial* material ) const;
+
+};
@@ -37,5 +37,28 @@
 MicroMaterialSpecification::MicroMaterialSpecification( ) 
 	: RenderPass{ 0 },
 	Subpass{ 0 },
-	Shaders{ }
-{ }
+	Shaders{ },
+	Bindings{ },
+	Attributes{ },
+	Topology{ VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST },
+	PolygonMode{ VK_POLYGON_MODE_FILL },
+	CullMode{ VK_CULL_MODE_BACK_BIT },
+	FrontFace{ VK_FRONT_FACE_COUNTER_CLOCKWISE },
+	Samples{ VK_SAMPLE_COUNT_1_BIT },
+	DepthTest{ VK_TRUE },
+	DepthWrite{ VK_TRUE },
+	DepthCompare{ VK_COMPARE_OP_LESS_OR_EQUAL },
+	Blends( 1 ),
+	Layouts{ },
+	PushConstants{ },
+	Bindless{ false }
+{
+	Blends[ 0 ].blendEnable			= VK_FALSE;
+	Blends[ 0 ].srcColorBlendFactor = VK_BLEND_FACTOR_ONE;
+	Blends[ 0 ].dstColorBlendFactor = VK_BLEND_FACTOR_ZERO;
+	Blends[ 0 ].colorBlendOp		= VK_BLEND_OP_ADD;
+	Blends[ 0 ].srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+	Blends[ 0 ].dstAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
+	Blends[ 0 ].alphaBlendOp		= VK_BLEND_OP_ADD;
+	Blends[ 0 ].colorWriteMask		= VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+}
@@ -38,6 +38,20 @@ micro_struct MicroMaterialSpecification {
 	uint32_t RenderPass;
 	uint32_t Subpass;
 	std::vector<MicroShaderSpecification> Shaders;
+	std::vector<VkVertexInputBindingDescription> Bindings;
+	std::vector<VkVertexInputAttributeDescription> Attributes;
+	VkPrimitiveTopology Topology;
+	VkPolygonMode PolygonMode;
+	VkCullModeFlags CullMode;
+	VkFrontFace FrontFace;
+	VkSampleCountFlagBits Samples;
+	VkBool32 DepthTest;
+	VkBool32 DepthWrite;
+	VkCompareOp DepthCompare;
+	std::vector<VkPipelineColorBlendAttachmentState> Blends;
+	std::vector<VkDescriptorSetLayout> Layouts;
+	std::vector<VkPushConstantRange> PushConstants;
+	bool Bindless;
 
 	MicroMaterialSpecification( );
 
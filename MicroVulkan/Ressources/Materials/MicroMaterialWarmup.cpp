@@ -0,0 +1,158 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "__micro_vulkan_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+MicroMaterialWarmup::MicroMaterialWarmup( )
+	: m_materials{ },
+	m_layouts{ }
+{ }
+
+bool MicroMaterialWarmup::Create( MicroVulkan& vulkan, MicroVulkanWorkerPool& workers ) {
+	auto entries		= vulkan.GetPipelines( ).GetManifest( );
+	auto specifications = std::vector<MicroMaterialSpecification>{ };
+	auto pendings		= std::vector<std::shared_future<VkPipeline>>{ };
+	auto result			= true;
+
+	specifications.reserve( entries.size( ) );
+
+	for ( auto& entry : entries ) {
+		auto specification = MicroMaterialSpecification{ };
+
+		if ( CreateSpecification( vulkan, entry, specification ) )
+			specifications.emplace_back( std::move( specification ) );
+	}
+
+	// Materials are sized once, the tasks capture them by address.
+	m_materials.resize( specifications.size( ) );
+	pendings.reserve( specifications.size( ) );
+
+	for ( auto material_id = (size_t)0; material_id < specifications.size( ); material_id++ ) {
+		auto& material = m_materials[ material_id ];
+
+		pendings.emplace_back( material.Create( vulkan, workers, specifications[ material_id ], VK_NULL_HANDLE ) );
+	}
+
+	// Shader object materials resolve to a null pipeline, success is read
+	// from the materials once every task has finished.
+	for ( auto& pending : pendings )
+		pending.wait( );
+
+	for ( auto& material : m_materials )
+		result = material.GetIsValid( ) && result;
+
+	return result;
+}
+
+void MicroMaterialWarmup::Destroy( MicroVulkan& vulkan ) {
+	auto& device   = vulkan.GetDevice( );
+	auto& registry = vulkan.GetPipelineRegistry( );
+
+	for ( auto& material : m_materials )
+		material.Destroy( vulkan );
+
+	for ( auto& layout : m_layouts )
+		registry.Release( device, layout );
+
+	m_materials.clear( );
+	m_layouts.clear( );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool MicroMaterialWarmup::CreateSpecification(
+	MicroVulkan& vulkan,
+	const std::vector<uint8_t>& entry,
+	MicroMaterialSpecification& specification
+) {
+	auto& device	  = vulkan.GetDevice( );
+	auto& registry	  = vulkan.GetPipelineRegistry( );
+	auto blob		  = MicroVulkanBlob{ entry.data( ), entry.size( ) };
+	auto shader_count = (uint32_t)0;
+	auto layout_count = (uint32_t)0;
+
+	blob.Read( specification.RenderPass );
+	blob.Read( specification.Subpass );
+	blob.Read( shader_count );
+
+	while ( blob && shader_count-- > 0 ) {
+		auto& shader = specification.Shaders.emplace_back( );
+
+		blob.Read( shader.Stage );
+		blob.Read( shader.Name );
+		blob.Read( shader.Code );
+		blob.Read( shader.Entries );
+		blob.Read( shader.Constants );
+	}
+
+	blob.Read( specification.Bindings );
+	blob.Read( specification.Attributes );
+	blob.Read( specification.Topology );
+	blob.Read( specification.PolygonMode );
+	blob.Read( specification.CullMode );
+	blob.Read( specification.FrontFace );
+	blob.Read( specification.Samples );
+	blob.Read( specification.DepthTest );
+	blob.Read( specification.DepthWrite );
+	blob.Read( specification.DepthCompare );
+	blob.Read( specification.Blends );
+	blob.Read( specification.Bindless );
+	blob.Read( layout_count );
+
+	// Render passes are created from the application specification, an
+	// entry recorded against a pass that no longer exists is dropped.
+	if ( !blob || !vk::IsValid( vulkan.GetRenderPass( specification.RenderPass ) ) )
+		return false;
+
+	while ( blob && layout_count-- > 0 ) {
+		auto bindings = std::vector<VkDescriptorSetLayoutBinding>{ };
+		auto layout	  = VkDescriptorSetLayout{ VK_NULL_HANDLE };
+
+		if ( !blob.Read( bindings ) || !registry.Acquire( device, bindings, layout ) )
+			return false;
+
+		specification.Layouts.emplace_back( layout );
+		m_layouts.emplace_back( layout );
+	}
+
+	return blob.Read( specification.PushConstants );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t MicroMaterialWarmup::GetCount( ) const {
+	return (uint32_t)m_materials.size( );
+}
@@ -37,5 +37,62 @@
 MicroShaderSpecification::MicroShaderSpecification( ) 
 	: Stage{ VK_SHADER_STAGE_VERTEX_BIT },
 	Name{ "" },
-	Code{ }
+	Code{ },
+	Entries{ },
+	Constants{ }
 { }
+
+MicroShaderSpecification& MicroShaderSpecification::Specialize(
+	const uint32_t constant_id,
+	const void* data,
+	const size_t length
+) {
+	auto* bytes = micro_cast( data, const uint8_t* );
+	auto entry	= std::find_if(
+		Entries.begin( ),
+		Entries.end( ),
+		[ constant_id ]( const auto& other ) { return other.constantID == constant_id; }
+	);
+
+	// Setting a constant twice overrides it in place, the pipeline hash
+	// only sees the final values.
+	if ( entry != Entries.end( ) && entry->size == length ) {
+		std::memcpy( Constants.data( ) + entry->offset, bytes, length );
+
+		return micro_self;
+	}
+
+	// A constant changing size is appended again, the data of the entries
+	// after it is packed back in place of the old value.
+	if ( entry != Entries.end( ) ) {
+		auto offset = entry->offset;
+		auto size	= (uint32_t)entry->size;
+
+		Constants.erase( Constants.begin( ) + offset, Constants.begin( ) + offset + size );
+		Entries.erase( entry );
+
+		for ( auto& other : Entries ) {
+			if ( other.offset > offset )
+				other.offset -= size;
+		}
+	}
+
+	Entries.emplace_back( VkSpecializationMapEntry{ constant_id, (uint32_t)Constants.size( ), length } );
+	Constants.insert( Constants.end( ), bytes, bytes + length );
+
+	return micro_self;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+VkSpecializationInfo MicroShaderSpecification::GetSpecialization( ) const {
+	auto specialization = VkSpecializationInfo{ };
+
+	specialization.mapEntryCount = (uint32_t)Entries.size( );
+	specialization.pMapEntries	 = Entries.data( );
+	specialization.dataSize		 = Constants.size( );
+	specialization.pData		 = Constants.data( );
+
+	return specialization;
+}
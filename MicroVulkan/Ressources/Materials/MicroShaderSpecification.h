@@ -31,14 +31,35 @@
 
 #pragma once
 
-#include "../Textures/MicroTexture.h"
+#include "../Textures/MicroTextureStreamer.h"
 
 micro_struct MicroShaderSpecification {
 
 	VkShaderStageFlagBits Stage;
 	std::string Name;
 	std::vector<uint32_t> Code;
+	std::vector<VkSpecializationMapEntry> Entries;
+	std::vector<uint8_t> Constants;
 
 	MicroShaderSpecification( );
 
+	MicroShaderSpecification& Specialize(
+		const uint32_t constant_id,
+		const void* data,
+		const size_t length
+	);
+
+	template<typename Type>
+		requires std::is_arithmetic_v<Type> && ( sizeof( Type ) == 4 || sizeof( Type ) == 8 || std::is_same_v<Type, bool> )
+	MicroShaderSpecification& Specialize( const uint32_t constant_id, const Type value ) {
+		micro_compile_if( std::is_same_v<Type, bool> ) {
+			auto boolean = (VkBool32)( value ? VK_TRUE : VK_FALSE );
+
+			return Specialize( constant_id, micro_ptr( boolean ), sizeof( VkBool32 ) );
+		} micro_compile_else
+			return Specialize( constant_id, micro_ptr( value ), sizeof( Type ) );
+	};
+
+	VkSpecializationInfo GetSpecialization( ) const;
+
 };
@@ -42,8 +42,33 @@ MicroVulkanStagingHandle::MicroVulkanStagingHandle( )
 { }
 
 VkResult MicroVulkanStagingHandle::Copy( const uint32_t length, const void* buffer ) { 
-	auto result = VK_SUCCESS;
+	auto offset = (uint32_t)0;
 
+	return Copy( length, buffer, offset );
+}
+
+VkResult MicroVulkanStagingHandle::Copy( 
+	const uint32_t length, 
+	const void* buffer,
+	uint32_t& offset
+) {
+	auto result = VK_ERROR_MEMORY_MAP_FAILED;
+
+	if ( GetIsValid( ) ) {
+		// Copy region offsets must be a multiple of the texel block size and of 4,
+		// STAGING_ALIGNMENT cover every format supported by the texture upload path.
+		const auto aligned = ( Occupancy + STAGING_ALIGNMENT - 1 ) & ~( STAGING_ALIGNMENT - 1 );
+
+		result = VK_ERROR_OUT_OF_HOST_MEMORY;
+
+		if ( aligned <= Handle->Length && length <= Handle->Length - aligned ) {
+			memcpy( Mapping + aligned, buffer, (size_t)length );
+
+			offset	  = aligned;
+			Occupancy = aligned + length;
+			result	  = VK_SUCCESS;
+		}
+	}
 
 	return result;
 }
@@ -64,7 +89,9 @@ uint32_t MicroVulkanStagingHandle::GetRemaining( ) const {
 }
 
 bool MicroVulkanStagingHandle::GetCanStore( const uint32_t length ) const {
-	return Occupancy < Handle->Length && length <= Handle->Length - Occupancy;
+	const auto aligned = ( Occupancy + STAGING_ALIGNMENT - 1 ) & ~( STAGING_ALIGNMENT - 1 );
+
+	return aligned < Handle->Length && length <= Handle->Length - aligned;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////
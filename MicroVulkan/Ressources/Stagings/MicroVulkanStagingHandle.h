@@ -35,6 +35,8 @@
 
 micro_struct MicroVulkanStagingHandle {
 
+	constexpr static uint32_t STAGING_ALIGNMENT = 16;
+
 	uint32_t StagingID;
 	uint32_t Occupancy;
 	uint8_t* Mapping;
@@ -44,6 +46,12 @@ micro_struct MicroVulkanStagingHandle {
 
 	VkResult Copy( const uint32_t length, const void* buffer );
 
+	VkResult Copy( 
+		const uint32_t length, 
+		const void* buffer,
+		uint32_t& offset
+	);
+
 	bool GetIsValid( ) const;
 
 	bool GetIsFull( )const;
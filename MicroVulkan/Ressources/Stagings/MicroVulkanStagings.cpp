@@ -46,11 +46,35 @@ bool MicroVulkanStagings::Create(
 
 MicroVulkanStagingHandle MicroVulkanStagings::Acquire(
 	const MicroVulkanDevice& device,
-	const MicroVulkanQueueHandle& queue
+	const MicroVulkanQueues& queues,
+	const uint32_t length
 ) { 
-	auto handle = MicroVulkanStagingHandle{ };
+	auto handle		= MicroVulkanStagingHandle{ };
+	auto staging_id = GetStagingID( length );
 
-	//vkMapMemory( device, m_stagings[ handle.StagingID ].Memory, 0, VK_WHOLE_SIZE, VK_UNUSED_FLAG, (void**)&handle.Mapping );
+	if ( staging_id == (uint32_t)m_stagings.size( ) ) {
+		auto& staging = m_stagings.emplace_back( );
+
+		if ( !CreateStagingBuffer( device, queues, length, staging ) ) {
+			staging.Buffer.Destroy( device );
+
+			m_stagings.pop_back( );
+
+			return handle;
+		}
+	}
+
+	auto& staging = m_stagings[ staging_id ];
+	auto* mapping = micro_cast( nullptr, void* );
+
+	if ( staging.Buffer.Map( device, mapping ) == VK_SUCCESS ) {
+		staging.InUse = VK_TRUE;
+
+		handle.StagingID = staging_id;
+		handle.Occupancy = 0;
+		handle.Mapping	 = micro_cast( mapping, uint8_t* );
+		handle.Handle	 = micro_ptr( staging );
+	}
 
 	return handle;
 }
@@ -64,7 +88,7 @@ void MicroVulkanStagings::Release(
 
 		staging.InUse = VK_FALSE;
 
-		//vkUnmapMemory( device, staging.Memory );
+		staging.Buffer.Unmap( device );
 
 		handle.StagingID = 0;
 		handle.Occupancy = 0;
@@ -74,19 +98,44 @@ void MicroVulkanStagings::Release(
 }
 
 void MicroVulkanStagings::Destroy( const MicroVulkanDevice& device ) {
+	for ( auto& staging : m_stagings )
+		staging.Buffer.Destroy( device );
+
+	m_stagings.clear( );
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
 bool MicroVulkanStagings::CreateStagingBuffer(
 	const MicroVulkanDevice& device,
-	const MicroVulkanQueues& queues
+	const MicroVulkanQueues& queues,
+	const uint32_t length,
+	MicroVulkanStagingBuffer& staging
 ) {
-	auto queue_count = queues.GetQueueSize( vk::QUEUE_TYPE_TRANSFERT );
+	auto buffer_spec = MicroVulkanBufferSpecification{ };
 
-	m_stagings.resize( queue_count );
+	buffer_spec.Capacity = (VkDeviceSize)std::max( length, STAGING_CAPACITY );
+	buffer_spec.Usage	 = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
 
-	while ( queue_count-- > 0 ) {
+	staging.InUse  = VK_FALSE;
+	staging.Length = (uint32_t)buffer_spec.Capacity;
 
+	return staging.Buffer.Create( device, queues, buffer_spec );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t MicroVulkanStagings::GetStagingID( const uint32_t length ) const {
+	auto staging_id = (uint32_t)0;
+
+	for ( const auto& staging : m_stagings ) {
+		if ( staging.InUse == VK_FALSE && staging.Length >= length )
+			break;
+
+		staging_id += 1;
 	}
 
-	return true;
+	return staging_id;
 }
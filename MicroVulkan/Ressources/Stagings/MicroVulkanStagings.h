@@ -35,8 +35,10 @@
 
 micro_class MicroVulkanStagings final {
 
+	constexpr static uint32_t STAGING_CAPACITY = 8 * 1024 * 1024;
+
 private:
-	std::vector<MicroVulkanStagingBuffer> m_stagings;
+	std::deque<MicroVulkanStagingBuffer> m_stagings;
 
 public:
 	MicroVulkanStagings( );
@@ -49,7 +51,8 @@ public:
 
 	MicroVulkanStagingHandle Acquire(
 		const MicroVulkanDevice& device,
-		const MicroVulkanQueueHandle& queue
+		const MicroVulkanQueues& queues,
+		const uint32_t length
 	);
 
 	void Release( 
@@ -62,7 +65,12 @@ public:
 private:
 	bool CreateStagingBuffer(
 		const MicroVulkanDevice& device,
-		const MicroVulkanQueues& queues
+		const MicroVulkanQueues& queues,
+		const uint32_t length,
+		MicroVulkanStagingBuffer& staging
 	);
 
+private:
+	uint32_t GetStagingID( const uint32_t length ) const;
+
 };
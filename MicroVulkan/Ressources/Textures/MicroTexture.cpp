@@ -36,7 +36,9 @@
 ////////////////////////////////////////////////////////////////////////////////////////////
 MicroTexture::MicroTexture( )
 	: m_texture{ },
-	m_specification{ }
+	m_specification{ },
+	m_image_index{ UINT32_MAX },
+	m_sampler_index{ UINT32_MAX }
 { }
 
 bool MicroTexture::Create( MicroVulkan& vulkan ) {
@@ -49,75 +51,238 @@ bool MicroTexture::Create(
     MicroVulkan& vulkan,
     MicroVulkanTextureSpecification& specification
 ) {
-    auto& device = vulkan.GetDevice( );
-    auto& queues = vulkan.GetQueues( );
+    auto& device   = vulkan.GetDevice( );
+    auto& queues   = vulkan.GetQueues( );
+    auto& cache    = vulkan.GetTextureCache( );
+    auto& bindless = vulkan.GetBindless( );
 
-    m_specification = specification.Properties;
+    m_specification        = specification.Properties;
+    m_specification.Layout = VK_IMAGE_LAYOUT_UNDEFINED;
 
-    return m_texture.Create( device, queues, specification );
+    if ( !m_texture.Create( device, queues, cache, specification ) )
+        return false;
+
+    // Indices are stable for the texture lifetime, the slot is written for
+    // the layout Fill leaves the image in.
+    if ( bindless.GetIsValid( ) ) {
+        bindless.Acquire( device, m_texture.GetView( ), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, m_image_index );
+        bindless.Acquire( device, m_texture.GetSampler( ), m_sampler_index );
+    }
+
+    return true;
 }
 
-void MicroTexture::Fill(
+bool MicroTexture::Fill(
     MicroVulkan& vulkan,
     const uint32_t length,
     const uint8_t* pixels
 ) {
-    auto& commands      = vulkan.GetCommands( );
-    auto command_handle = commands.Acquire( vk::QUEUE_TYPE_GRAPHICS, VK_COMMAND_BUFFER_LEVEL_PRIMARY );
-    auto barrier_spec   = vk::PipelineBarrier{ };
-    auto image_spec     = VkImageMemoryBarrier{ }; 
-    auto& queues        = vulkan.GetQueues( );
-    
-    image_spec = CreateTransitionSpec( queues, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL );
+    auto upload_context = MicroVulkanUploadContext{ };
+    auto state          = vulkan.AcquireUpload( upload_context );
+
+    if ( state ) {
+        state = Fill( vulkan, upload_context, length, pixels );
+        state = ( vulkan.SubmitUpload( upload_context ) == VK_SUCCESS ) && state;
+    }
+
+    return state;
+}
+
+bool MicroTexture::Fill(
+    MicroVulkan& vulkan,
+    MicroVulkanUploadContext& upload_context,
+    const uint32_t length,
+    const uint8_t* pixels
+) {
+    auto aspect  = GetImageAspect( );
+    auto regions = std::vector<VkBufferImageCopy>{ };
+    auto offset  = (VkDeviceSize)0;
+    auto level   = (uint32_t)0;
+
+    // Pixels are expected level-major and tightly packed, when only part of
+    // the chain is provided the missing levels are generated on the GPU.
+    while ( level < m_specification.MipLevels ) {
+        auto level_length = GetLevelLength( level ) * m_specification.ArrayLayers;
+
+        if ( level_length == 0 || offset + level_length > length )
+            break;
+
+        auto& region = regions.emplace_back( );
+
+        region.bufferOffset                    = offset;
+        region.bufferRowLength                 = 0;
+        region.bufferImageHeight               = 0;
+        region.imageSubresource.aspectMask     = aspect;
+        region.imageSubresource.mipLevel       = level;
+        region.imageSubresource.baseArrayLayer = 0;
+        region.imageSubresource.layerCount     = m_specification.ArrayLayers;
+        region.imageOffset                     = { 0, 0, 0 };
+        region.imageExtent                     = GetLevelExtent( level );
+
+        offset += level_length;
+        level  += 1;
+    }
+
+    if ( regions.empty( ) )
+        return false;
+
+    return Fill( vulkan, upload_context, length, pixels, regions, level );
+}
+
+bool MicroTexture::Fill(
+    MicroVulkan& vulkan,
+    MicroVulkanUploadContext& upload_context,
+    const uint32_t length,
+    const uint8_t* pixels,
+    const std::vector<VkBufferImageCopy>& regions,
+    const uint32_t generate_level
+) {
+    auto& device  = vulkan.GetDevice( );
+    auto& queues  = vulkan.GetQueues( );
+    auto& command = upload_context.CommandBuffer.Buffer;
+    auto buffer   = (VkBuffer)VK_NULL_HANDLE;
+    auto offset   = (uint32_t)0;
+    auto filter   = VK_FILTER_NEAREST;
+
+    if ( regions.empty( ) || vulkan.Stage( upload_context, length, pixels, buffer, offset ) != VK_SUCCESS )
+        return false;
+
+    auto copies = regions;
+
+    for ( auto& copy : copies )
+        copy.bufferOffset += offset;
+
+    CmdTransition( queues, command, m_specification.Layout, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 0, m_specification.MipLevels );
 
-    barrier_spec.SrcStageMask = 0;
-    barrier_spec.DstStageMask = 0;
-    barrier_spec.DependencyFlags = 0;
-    
-    vk::CmdImageBarrier( command_handle.Buffer, barrier_spec, image_spec );
+    vk::CmdCopyBufferToImage( command, buffer, m_texture, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, copies );
 
-    image_spec = CreateTransitionSpec( queues, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL );
+    // Level 0 is always provided, a generate level of 0 or past the chain
+    // means every level was uploaded.
+    if ( generate_level > 0 && generate_level < m_specification.MipLevels && GetCanBlit( device, filter ) )
+        CmdGenerateMips( queues, command, filter, generate_level );
+    else
+        CmdTransition( queues, command, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 0, m_specification.MipLevels );
 
-    barrier_spec.SrcStageMask = 0;
-    barrier_spec.DstStageMask = 0;
-    barrier_spec.DependencyFlags = 0;
+    m_specification.Layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
 
-    vk::CmdImageBarrier( command_handle.Buffer, barrier_spec, image_spec );
+    return true;
 }
 
-void MicroTexture::Destroy( const MicroVulkan& vulkan ) {
-    auto& device = vulkan.GetDevice( );
+void MicroTexture::Destroy( MicroVulkan& vulkan ) {
+    auto& device   = vulkan.GetDevice( );
+    auto& cache    = vulkan.GetTextureCache( );
+    auto& bindless = vulkan.GetBindless( );
 
-    m_texture.Destroy( device );
+    bindless.Release( VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, m_image_index );
+    bindless.Release( VK_DESCRIPTOR_TYPE_SAMPLER, m_sampler_index );
+
+    m_texture.Destroy( device, cache );
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
 VkImageMemoryBarrier MicroTexture::CreateTransitionSpec(
 	const MicroVulkanQueues& queues,
-    const VkImageLayout target_layout
+    const VkImageLayout source_layout,
+    const VkImageLayout target_layout,
+    const uint32_t base_level,
+    const uint32_t level_count
 ) {
     auto transition_spec = VkImageMemoryBarrier{ };
     auto graphics_queue  = queues.GetQueueFamily( vk::QUEUE_TYPE_GRAPHICS );
 
     transition_spec.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
     transition_spec.pNext                           = VK_NULL_HANDLE;
-    transition_spec.srcAccessMask                   = VK_ACCESS_NONE;
-    transition_spec.dstAccessMask                   = VK_ACCESS_NONE;
-    transition_spec.oldLayout                       = m_specification.Layout;
+    transition_spec.srcAccessMask                   = vk::GetLayoutAccess( source_layout );
+    transition_spec.dstAccessMask                   = vk::GetLayoutAccess( target_layout );
+    transition_spec.oldLayout                       = source_layout;
     transition_spec.newLayout                       = target_layout;
     transition_spec.srcQueueFamilyIndex             = graphics_queue;
     transition_spec.dstQueueFamilyIndex             = graphics_queue;
     transition_spec.image                           = m_texture;
     transition_spec.subresourceRange.aspectMask     = GetImageAspect( );
-    transition_spec.subresourceRange.baseMipLevel   = 0;
-    transition_spec.subresourceRange.levelCount     = m_specification.MipLevels;
+    transition_spec.subresourceRange.baseMipLevel   = base_level;
+    transition_spec.subresourceRange.levelCount     = level_count;
     transition_spec.subresourceRange.baseArrayLayer = 0;
     transition_spec.subresourceRange.layerCount     = m_specification.ArrayLayers;
 
-    m_specification.Layout = target_layout;
-
     return transition_spec;
 }
 
+VkImageBlit MicroTexture::CreateBlitSpec( const uint32_t level ) {
+    auto blit_spec   = VkImageBlit{ };
+    auto aspect      = GetImageAspect( );
+    auto source      = GetLevelExtent( level - 1 );
+    auto destination = GetLevelExtent( level );
+
+    blit_spec.srcSubresource.aspectMask     = aspect;
+    blit_spec.srcSubresource.mipLevel       = level - 1;
+    blit_spec.srcSubresource.baseArrayLayer = 0;
+    blit_spec.srcSubresource.layerCount     = m_specification.ArrayLayers;
+    blit_spec.srcOffsets[ 0 ]               = { 0, 0, 0 };
+    blit_spec.srcOffsets[ 1 ]               = { (int32_t)source.width, (int32_t)source.height, (int32_t)source.depth };
+    blit_spec.dstSubresource.aspectMask     = aspect;
+    blit_spec.dstSubresource.mipLevel       = level;
+    blit_spec.dstSubresource.baseArrayLayer = 0;
+    blit_spec.dstSubresource.layerCount     = m_specification.ArrayLayers;
+    blit_spec.dstOffsets[ 0 ]               = { 0, 0, 0 };
+    blit_spec.dstOffsets[ 1 ]               = { (int32_t)destination.width, (int32_t)destination.height, (int32_t)destination.depth };
+
+    return blit_spec;
+}
+
+void MicroTexture::CmdTransition(
+    const MicroVulkanQueues& queues,
+    const VkCommandBuffer& commands,
+    const VkImageLayout source_layout,
+    const VkImageLayout target_layout,
+    const uint32_t base_level,
+    const uint32_t level_count
+) {
+    auto barrier_spec = vk::PipelineBarrier{ };
+    auto image_spec   = CreateTransitionSpec( queues, source_layout, target_layout, base_level, level_count );
+
+    barrier_spec.SrcStageMask    = vk::GetLayoutStage( source_layout );
+    barrier_spec.DstStageMask    = vk::GetLayoutStage( target_layout );
+    barrier_spec.DependencyFlags = VK_UNUSED_FLAG;
+
+    vk::CmdImageBarrier( commands, barrier_spec, image_spec );
+}
+
+void MicroTexture::CmdGenerateMips(
+    const MicroVulkanQueues& queues,
+    const VkCommandBuffer& commands,
+    const VkFilter filter,
+    const uint32_t base_level
+) {
+    auto level = base_level;
+
+    // Uploaded levels before the blit source are released to the shaders
+    // untouched.
+    if ( level > 1 )
+        CmdTransition( queues, commands, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 0, level - 1 );
+
+    // Each level is read back as blit source once written, then released
+    // to the shaders, only the last level stays in transfer destination.
+    while ( level < m_specification.MipLevels ) {
+        auto blit_spec = CreateBlitSpec( level );
+
+        CmdTransition( queues, commands, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, level - 1, 1 );
+
+        vk::CmdBlitImage( commands, m_texture, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, m_texture, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, blit_spec, filter );
+
+        CmdTransition( queues, commands, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, level - 1, 1 );
+
+        level += 1;
+    }
+
+    CmdTransition( queues, commands, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, level - 1, 1 );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
 const MicroVulkanTexture& MicroTexture::Get( ) const {
 	return m_texture;
 }
@@ -126,6 +291,21 @@ const MicroTextureProperties& MicroTexture::GetSpecification( ) const {
 	return m_specification;
 }
 
+VkDeviceSize MicroTexture::GetLevelLength( const uint32_t level ) const {
+    return m_specification.GetLevelLength( level );
+}
+
+uint32_t MicroTexture::GetImageIndex( ) const {
+    return m_image_index;
+}
+
+uint32_t MicroTexture::GetSamplerIndex( ) const {
+    return m_sampler_index;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
 VkImageAspectFlagBits MicroTexture::GetImageAspect( ) const {
     auto aspect = VK_IMAGE_ASPECT_COLOR_BIT;
 
@@ -146,6 +326,23 @@ VkImageAspectFlagBits MicroTexture::GetImageAspect( ) const {
     return aspect;
 }
 
+VkExtent3D MicroTexture::GetLevelExtent( const uint32_t level ) const {
+    return m_specification.GetLevelExtent( level );
+}
+
+bool MicroTexture::GetCanBlit( const MicroVulkanDevice& device, VkFilter& filter ) const {
+    auto properties = device.GetFormatProperties( m_specification.Format );
+    auto features   = properties.optimalTilingFeatures;
+    auto blit_mask  = (VkFormatFeatureFlags)( VK_FORMAT_FEATURE_BLIT_SRC_BIT | VK_FORMAT_FEATURE_BLIT_DST_BIT );
+
+    filter = ( features & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT ) ? VK_FILTER_LINEAR : VK_FILTER_NEAREST;
+
+    return ( features & blit_mask ) == blit_mask;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	OPERATOR ===
+////////////////////////////////////////////////////////////////////////////////////////////
 MicroTexture::operator const MicroVulkanTexture& ( ) const {
 	return Get( );
 }
@@ -31,13 +31,15 @@
 
 #pragma once
 
-#include "../../MicroVulkan.h"
+#include "../Buffers/MicroBuffer.h"
 
 micro_class MicroTexture {
 
 private:
 	MicroVulkanTexture m_texture;
 	MicroTextureProperties m_specification;
+	uint32_t m_image_index;
+	uint32_t m_sampler_index;
 
 public:
 	MicroTexture( );
@@ -51,18 +53,55 @@ public:
 		MicroVulkanTextureSpecification& specificayion 
 	);
 
-	void Fill( 
+	bool Fill( 
 		MicroVulkan& vulkan,
 		const uint32_t length,
 		const uint8_t* pixels
 	);
+
+	bool Fill( 
+		MicroVulkan& vulkan,
+		MicroVulkanUploadContext& upload_context,
+		const uint32_t length,
+		const uint8_t* pixels
+	);
+
+	bool Fill( 
+		MicroVulkan& vulkan,
+		MicroVulkanUploadContext& upload_context,
+		const uint32_t length,
+		const uint8_t* pixels,
+		const std::vector<VkBufferImageCopy>& regions,
+		const uint32_t generate_level
+	);
 	
-	void Destroy( const MicroVulkan& vulkan );
+	void Destroy( MicroVulkan& vulkan );
 
 private:
 	VkImageMemoryBarrier CreateTransitionSpec( 
 		const MicroVulkanQueues& queues, 
-		const VkImageLayout target_layout
+		const VkImageLayout source_layout,
+		const VkImageLayout target_layout,
+		const uint32_t base_level,
+		const uint32_t level_count
+	);
+
+	VkImageBlit CreateBlitSpec( const uint32_t level );
+
+	void CmdTransition( 
+		const MicroVulkanQueues& queues,
+		const VkCommandBuffer& commands,
+		const VkImageLayout source_layout,
+		const VkImageLayout target_layout,
+		const uint32_t base_level,
+		const uint32_t level_count
+	);
+
+	void CmdGenerateMips( 
+		const MicroVulkanQueues& queues,
+		const VkCommandBuffer& commands,
+		const VkFilter filter,
+		const uint32_t base_level
 	);
 
 public:
@@ -70,9 +109,19 @@ public:
 	
 	const MicroTextureProperties& GetSpecification( ) const;
 
+	VkDeviceSize GetLevelLength( const uint32_t level ) const;
+
+	uint32_t GetImageIndex( ) const;
+
+	uint32_t GetSamplerIndex( ) const;
+
 private:
 	VkImageAspectFlagBits GetImageAspect( ) const;
 
+	VkExtent3D GetLevelExtent( const uint32_t level ) const;
+
+	bool GetCanBlit( const MicroVulkanDevice& device, VkFilter& filter ) const;
+
 public:
 	operator const MicroVulkanTexture& ( ) const;
 
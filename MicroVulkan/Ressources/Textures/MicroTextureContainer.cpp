@@ -0,0 +1,447 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "__micro_vulkan_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	INTERNAL ===
+////////////////////////////////////////////////////////////////////////////////////////////
+#define micro_four_cc( A, B, C, D )\
+	( (uint32_t)(A) | ( (uint32_t)(B) << 8 ) | ( (uint32_t)(C) << 16 ) | ( (uint32_t)(D) << 24 ) )
+
+constexpr uint8_t ivk_KTX2Identifier[ 12 ] = { 
+	0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A 
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+MicroTextureContainer::MicroTextureContainer( )
+	: m_file{ },
+	m_specification{ },
+	m_regions{ },
+	m_offset{ 0 },
+	m_length{ 0 },
+	m_generate_mips{ false }
+{ }
+
+bool MicroTextureContainer::Open( const std::string& path ) {
+	Close( );
+
+	auto state = m_file.Open( path ) && ( ParseKTX2( ) || ParseDDS( ) );
+
+	// Block compressed formats can't be attachments nor blit destinations.
+	if ( state ) {
+		m_specification.Usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+
+		if ( m_generate_mips )
+			m_specification.Usage |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+	} else
+		Close( );
+
+	return state;
+}
+
+bool MicroTextureContainer::Create( MicroVulkan& vulkan, MicroTexture& texture ) {
+	auto upload_context = MicroVulkanUploadContext{ };
+	auto state			= vulkan.AcquireUpload( upload_context );
+
+	if ( state ) {
+		state = Create( vulkan, upload_context, texture );
+		state = ( vulkan.SubmitUpload( upload_context ) == VK_SUCCESS ) && state;
+	}
+
+	return state;
+}
+
+bool MicroTextureContainer::Create(
+	MicroVulkan& vulkan,
+	MicroVulkanUploadContext& upload_context,
+	MicroTexture& texture
+) {
+	return Create( vulkan, upload_context, texture, 0 );
+}
+
+bool MicroTextureContainer::Create(
+	MicroVulkan& vulkan,
+	MicroVulkanUploadContext& upload_context,
+	MicroTexture& texture,
+	const uint32_t base_level
+) {
+	auto& device = vulkan.GetDevice( );
+
+	if ( !GetIsValid( ) || !GetIsSupported( device ) || base_level >= GetLevelCount( ) )
+		return false;
+
+	auto specification = m_specification;
+	auto& properties   = specification.Properties;
+	auto regions	   = std::vector<VkBufferImageCopy>{ };
+	auto first		   = UINT64_MAX;
+	auto last		   = (uint64_t)0;
+
+	properties.Extent	 = m_specification.Properties.GetLevelExtent( base_level );
+	properties.MipLevels = m_specification.Properties.MipLevels - base_level;
+
+	// Only the requested levels are staged, renumbered from the new base level.
+	for ( auto& region : m_regions ) {
+		auto level = region.imageSubresource.mipLevel;
+
+		if ( level < base_level )
+			continue;
+
+		auto length = m_specification.Properties.GetLevelLength( level ) * region.imageSubresource.layerCount;
+
+		first = std::min( first, region.bufferOffset );
+		last  = std::max( last, region.bufferOffset + length );
+
+		auto& copy = regions.emplace_back( region );
+
+		copy.imageSubresource.mipLevel = level - base_level;
+	}
+
+	for ( auto& region : regions )
+		region.bufferOffset -= first;
+
+	auto* pixels = m_file.GetData( m_offset + first, last - first );
+
+	return  pixels != NULL							&&
+			texture.Create( vulkan, specification ) &&
+			texture.Fill( vulkan, upload_context, (uint32_t)( last - first ), pixels, regions, m_generate_mips ? 1 : 0 );
+}
+
+void MicroTextureContainer::Close( ) {
+	m_file.Close( );
+	m_regions.clear( );
+
+	m_specification = { };
+	m_offset		= 0;
+	m_length		= 0;
+	m_generate_mips = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool MicroTextureContainer::ParseKTX2( ) {
+	auto* header = micro_cast( m_file.GetData( 0, sizeof( MicroKTX2Header ) ), const MicroKTX2Header* );
+
+	// Supercompressed and Basis Universal payloads would need a CPU transcode.
+	if ( 
+		header == NULL																	  ||
+		memcmp( header->Identifier, ivk_KTX2Identifier, sizeof( ivk_KTX2Identifier ) ) != 0 ||
+		header->Format == VK_FORMAT_UNDEFINED											  ||
+		header->Supercompression != 0													  ||
+		header->Width == 0																  ||
+		( header->FaceCount != 1 && header->FaceCount != 6 )
+	)
+		return false;
+
+	auto level_count = std::max( header->LevelCount, 1u );
+	auto layer_count = std::max( header->LayerCount, 1u ) * header->FaceCount;
+	auto& properties = m_specification.Properties;
+
+	properties.Format		   = (VkFormat)header->Format;
+	properties.Layout		   = VK_IMAGE_LAYOUT_UNDEFINED;
+	properties.Extent		   = { header->Width, std::max( header->Height, 1u ), std::max( header->Depth, 1u ) };
+	properties.MipLevels	   = level_count;
+	properties.ArrayLayers	   = layer_count;
+	m_specification.Type	   = header->Depth > 0 ? VK_IMAGE_TYPE_3D : ( header->Height > 0 ? VK_IMAGE_TYPE_2D : VK_IMAGE_TYPE_1D );
+	m_specification.IsCubemap  = header->FaceCount == 6 ? VK_TRUE : VK_FALSE;
+	m_generate_mips			   = header->LevelCount == 0;
+
+	// A level past the 1x1 one has no extent, such files are malformed.
+	if ( level_count > GetMipCount( ) )
+		return false;
+
+	// Blits can't write block compressed texels, such files must ship their
+	// whole mip chain.
+	if ( m_generate_mips ) {
+		auto block = vk::GetFormatBlock( properties.Format );
+
+		if ( block.Width > 1 || block.Height > 1 )
+			return false;
+	}
+
+	if ( m_generate_mips )
+		properties.MipLevels = GetMipCount( );
+
+	auto* levels = micro_cast( m_file.GetData( sizeof( MicroKTX2Header ), level_count * sizeof( MicroKTX2Level ) ), const MicroKTX2Level* );
+
+	if ( levels == NULL )
+		return false;
+
+	// Levels are stored smallest first, the upload window spans all of them.
+	auto first = UINT64_MAX;
+	auto last  = (uint64_t)0;
+	auto level = level_count;
+
+	while ( level-- > 0 ) {
+		auto& source = levels[ level ];
+
+		if ( source.Length < properties.GetLevelLength( level ) * layer_count )
+			return false;
+
+		first = std::min( first, source.Offset );
+		last  = std::max( last, source.Offset + source.Length );
+	}
+
+	if ( m_file.GetData( first, last - first ) == NULL || last - first > UINT32_MAX )
+		return false;
+
+	m_offset = first;
+	m_length = last - first;
+
+	for ( level = 0; level < level_count; level++ )
+		m_regions.emplace_back( CreateRegionSpec( levels[ level ].Offset - first, level, 0, layer_count ) );
+
+	return true;
+}
+
+bool MicroTextureContainer::ParseDDS( ) {
+	auto* header = micro_cast( m_file.GetData( 0, sizeof( MicroDDSHeader ) ), const MicroDDSHeader* );
+
+	if ( header == NULL || header->Magic != DDS_MAGIC || header->Size != sizeof( MicroDDSHeader ) - sizeof( uint32_t ) )
+		return false;
+
+	auto& properties = m_specification.Properties;
+	auto offset		 = (uint64_t)sizeof( MicroDDSHeader );
+	auto is_volume	 = ( header->Flags & DDS_FLAG_DEPTH ) && ( header->Caps2 & DDS_CAPS_VOLUME );
+	auto layer_count = (uint32_t)1;
+
+	properties.Format	   = VK_FORMAT_UNDEFINED;
+	properties.Layout	   = VK_IMAGE_LAYOUT_UNDEFINED;
+	properties.Extent	   = { header->Width, std::max( header->Height, 1u ), is_volume ? std::max( header->Depth, 1u ) : 1u };
+	properties.MipLevels   = ( header->Flags & DDS_FLAG_MIPS ) ? std::max( header->MipCount, 1u ) : 1u;
+	m_specification.Type   = is_volume ? VK_IMAGE_TYPE_3D : VK_IMAGE_TYPE_2D;
+
+	if ( ( header->Format.Flags & DDS_FORMAT_FOURCC ) && header->Format.FourCC == DDS_DX10 ) {
+		auto* extension = micro_cast( m_file.GetData( offset, sizeof( MicroDDSHeaderDX10 ) ), const MicroDDSHeaderDX10* );
+
+		if ( extension == NULL )
+			return false;
+
+		offset			   += sizeof( MicroDDSHeaderDX10 );
+		properties.Format	= GetDXGIFormat( extension->Format );
+		layer_count			= std::max( extension->ArraySize, 1u );
+
+		if ( extension->Dimension == 2 )
+			m_specification.Type = VK_IMAGE_TYPE_1D;
+		else if ( extension->Dimension == 4 )
+			m_specification.Type = VK_IMAGE_TYPE_3D;
+
+		if ( extension->MiscFlags & DDS_DX10_CUBEMAP ) {
+			m_specification.IsCubemap = VK_TRUE;
+			layer_count				 *= 6;
+		}
+	} else {
+		properties.Format = GetDDSFormat( header->Format );
+
+		if ( header->Caps2 & DDS_CAPS_CUBEMAP ) {
+			m_specification.IsCubemap = VK_TRUE;
+			layer_count				  = 6;
+		}
+	}
+
+	if ( properties.Format == VK_FORMAT_UNDEFINED || header->Width == 0 || properties.MipLevels > GetMipCount( ) )
+		return false;
+
+	properties.ArrayLayers = layer_count;
+
+	// Surfaces are stored layer major, every layer holds its whole mip chain.
+	auto start = offset;
+	auto layer = (uint32_t)0;
+
+	while ( layer < layer_count ) {
+		auto level = (uint32_t)0;
+
+		while ( level < properties.MipLevels ) {
+			m_regions.emplace_back( CreateRegionSpec( offset - start, level, layer, 1 ) );
+
+			offset += properties.GetLevelLength( level );
+			level  += 1;
+		}
+
+		layer += 1;
+	}
+
+	if ( m_file.GetData( start, offset - start ) == NULL || offset - start > UINT32_MAX )
+		return false;
+
+	m_offset = start;
+	m_length = offset - start;
+
+	return true;
+}
+
+VkBufferImageCopy MicroTextureContainer::CreateRegionSpec(
+	const uint64_t offset,
+	const uint32_t level,
+	const uint32_t base_layer,
+	const uint32_t layer_count
+) const {
+	auto region_spec = VkBufferImageCopy{ };
+
+	region_spec.bufferOffset					= offset;
+	region_spec.bufferRowLength					= 0;
+	region_spec.bufferImageHeight				= 0;
+	region_spec.imageSubresource.aspectMask		= VK_IMAGE_ASPECT_COLOR_BIT;
+	region_spec.imageSubresource.mipLevel		= level;
+	region_spec.imageSubresource.baseArrayLayer = base_layer;
+	region_spec.imageSubresource.layerCount		= layer_count;
+	region_spec.imageOffset						= { 0, 0, 0 };
+	region_spec.imageExtent						= m_specification.Properties.GetLevelExtent( level );
+
+	return region_spec;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool MicroTextureContainer::GetIsValid( ) const {
+	return m_file.GetIsValid( ) && !m_regions.empty( );
+}
+
+bool MicroTextureContainer::GetIsSupported( const MicroVulkanDevice& device ) const {
+	auto properties = device.GetFormatProperties( m_specification.Properties.Format );
+	auto features	= properties.optimalTilingFeatures;
+	auto required	= (VkFormatFeatureFlags)( VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT | VK_FORMAT_FEATURE_TRANSFER_DST_BIT );
+
+	// Generated mips are blitted from the previous level of the same image.
+	if ( m_generate_mips )
+		required |= VK_FORMAT_FEATURE_TRANSFER_SRC_BIT | VK_FORMAT_FEATURE_BLIT_SRC_BIT | VK_FORMAT_FEATURE_BLIT_DST_BIT;
+
+	return ( features & required ) == required;
+}
+
+const MicroVulkanTextureSpecification& MicroTextureContainer::GetSpecification( ) const {
+	return m_specification;
+}
+
+uint32_t MicroTextureContainer::GetLevelCount( ) const {
+	return m_generate_mips ? 1 : m_specification.Properties.MipLevels;
+}
+
+uint64_t MicroTextureContainer::GetResidentLength( const uint32_t base_level ) const {
+	auto& properties = m_specification.Properties;
+	auto length		 = (uint64_t)0;
+	auto level		 = properties.MipLevels;
+
+	while ( level-- > base_level )
+		length += properties.GetLevelLength( level ) * properties.ArrayLayers;
+
+	return length;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t MicroTextureContainer::GetMipCount( ) const {
+	auto& extent = m_specification.Properties.Extent;
+	auto size	 = std::max( { extent.width, extent.height, extent.depth } );
+	auto count	 = (uint32_t)1;
+
+	while ( size >>= 1 )
+		count += 1;
+
+	return count;
+}
+
+VkFormat MicroTextureContainer::GetDDSFormat( const MicroDDSPixelFormat& format ) const {
+	auto result = VK_FORMAT_UNDEFINED;
+
+	if ( format.Flags & DDS_FORMAT_FOURCC ) {
+		switch ( format.FourCC ) {
+			case micro_four_cc( 'D', 'X', 'T', '1' ) : result = VK_FORMAT_BC1_RGBA_UNORM_BLOCK; break;
+			case micro_four_cc( 'D', 'X', 'T', '2' ) : 
+			case micro_four_cc( 'D', 'X', 'T', '3' ) : result = VK_FORMAT_BC2_UNORM_BLOCK; break;
+			case micro_four_cc( 'D', 'X', 'T', '4' ) : 
+			case micro_four_cc( 'D', 'X', 'T', '5' ) : result = VK_FORMAT_BC3_UNORM_BLOCK; break;
+			case micro_four_cc( 'A', 'T', 'I', '1' ) : 
+			case micro_four_cc( 'B', 'C', '4', 'U' ) : result = VK_FORMAT_BC4_UNORM_BLOCK; break;
+			case micro_four_cc( 'B', 'C', '4', 'S' ) : result = VK_FORMAT_BC4_SNORM_BLOCK; break;
+			case micro_four_cc( 'A', 'T', 'I', '2' ) : 
+			case micro_four_cc( 'B', 'C', '5', 'U' ) : result = VK_FORMAT_BC5_UNORM_BLOCK; break;
+			case micro_four_cc( 'B', 'C', '5', 'S' ) : result = VK_FORMAT_BC5_SNORM_BLOCK; break;
+
+			default : break;
+		}
+	} else if ( ( format.Flags & DDS_FORMAT_RGB ) && format.BitCount == 32 ) {
+		if ( format.RMask == 0x000000FF && format.GMask == 0x0000FF00 && format.BMask == 0x00FF0000 )
+			result = VK_FORMAT_R8G8B8A8_UNORM;
+		else if ( format.RMask == 0x00FF0000 && format.GMask == 0x0000FF00 && format.BMask == 0x000000FF )
+			result = VK_FORMAT_B8G8R8A8_UNORM;
+	}
+
+	return result;
+}
+
+VkFormat MicroTextureContainer::GetDXGIFormat( const uint32_t dxgi_format ) const {
+	auto result = VK_FORMAT_UNDEFINED;
+
+	switch ( dxgi_format ) {
+		case  2 : result = VK_FORMAT_R32G32B32A32_SFLOAT;	   break;
+		case 10 : result = VK_FORMAT_R16G16B16A16_SFLOAT;	   break;
+		case 24 : result = VK_FORMAT_A2B10G10R10_UNORM_PACK32; break;
+		case 26 : result = VK_FORMAT_B10G11R11_UFLOAT_PACK32;  break;
+		case 28 : result = VK_FORMAT_R8G8B8A8_UNORM;		   break;
+		case 29 : result = VK_FORMAT_R8G8B8A8_SRGB;			   break;
+		case 49 : result = VK_FORMAT_R8G8_UNORM;			   break;
+		case 61 : result = VK_FORMAT_R8_UNORM;				   break;
+		case 67 : result = VK_FORMAT_E5B9G9R9_UFLOAT_PACK32;   break;
+		case 71 : result = VK_FORMAT_BC1_RGBA_UNORM_BLOCK;	   break;
+		case 72 : result = VK_FORMAT_BC1_RGBA_SRGB_BLOCK;	   break;
+		case 74 : result = VK_FORMAT_BC2_UNORM_BLOCK;		   break;
+		case 75 : result = VK_FORMAT_BC2_SRGB_BLOCK;		   break;
+		case 77 : result = VK_FORMAT_BC3_UNORM_BLOCK;		   break;
+		case 78 : result = VK_FORMAT_BC3_SRGB_BLOCK;		   break;
+		case 80 : result = VK_FORMAT_BC4_UNORM_BLOCK;		   break;
+		case 81 : result = VK_FORMAT_BC4_SNORM_BLOCK;		   break;
+		case 83 : result = VK_FORMAT_BC5_UNORM_BLOCK;		   break;
+		case 84 : result = VK_FORMAT_BC5_SNORM_BLOCK;		   break;
+		case 87 : result = VK_FORMAT_B8G8R8A8_UNORM;		   break;
+		case 91 : result = VK_FORMAT_B8G8R8A8_SRGB;			   break;
+		case 95 : result = VK_FORMAT_BC6H_UFLOAT_BLOCK;		   break;
+		case 96 : result = VK_FORMAT_BC6H_SFLOAT_BLOCK;		   break;
+		case 98 : result = VK_FORMAT_BC7_UNORM_BLOCK;		   break;
+		case 99 : result = VK_FORMAT_BC7_SRGB_BLOCK;		   break;
+
+		default : break;
+	}
+
+	return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	OPERATOR ===
+////////////////////////////////////////////////////////////////////////////////////////////
+MicroTextureContainer::operator bool ( ) const {
+	return GetIsValid( );
+}
@@ -0,0 +1,113 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "MicroTextureContainerHeader.h"
+
+micro_class MicroTextureContainer final {
+
+	constexpr static uint32_t DDS_MAGIC         = 0x20534444;
+	constexpr static uint32_t DDS_DX10          = 0x30315844;
+	constexpr static uint32_t DDS_FLAG_MIPS     = 0x00020000;
+	constexpr static uint32_t DDS_FLAG_DEPTH    = 0x00800000;
+	constexpr static uint32_t DDS_FORMAT_FOURCC = 0x00000004;
+	constexpr static uint32_t DDS_FORMAT_RGB    = 0x00000040;
+	constexpr static uint32_t DDS_CAPS_CUBEMAP  = 0x00000200;
+	constexpr static uint32_t DDS_CAPS_VOLUME   = 0x00200000;
+	constexpr static uint32_t DDS_DX10_CUBEMAP  = 0x00000004;
+
+private:
+	MicroVulkanMappedFile m_file;
+	MicroVulkanTextureSpecification m_specification;
+	std::vector<VkBufferImageCopy> m_regions;
+	uint64_t m_offset;
+	uint64_t m_length;
+	bool m_generate_mips;
+
+public:
+	MicroTextureContainer( );
+
+	~MicroTextureContainer( ) = default;
+
+	bool Open( const std::string& path );
+
+	bool Create( MicroVulkan& vulkan, MicroTexture& texture );
+
+	bool Create( 
+		MicroVulkan& vulkan, 
+		MicroVulkanUploadContext& upload_context,
+		MicroTexture& texture 
+	);
+
+	bool Create( 
+		MicroVulkan& vulkan, 
+		MicroVulkanUploadContext& upload_context,
+		MicroTexture& texture,
+		const uint32_t base_level
+	);
+
+	void Close( );
+
+private:
+	bool ParseKTX2( );
+
+	bool ParseDDS( );
+
+	VkBufferImageCopy CreateRegionSpec(
+		const uint64_t offset,
+		const uint32_t level,
+		const uint32_t base_layer,
+		const uint32_t layer_count
+	) const;
+
+public:
+	bool GetIsValid( ) const;
+
+	bool GetIsSupported( const MicroVulkanDevice& device ) const;
+
+	const MicroVulkanTextureSpecification& GetSpecification( ) const;
+
+	uint32_t GetLevelCount( ) const;
+
+	uint64_t GetResidentLength( const uint32_t base_level ) const;
+
+private:
+	uint32_t GetMipCount( ) const;
+
+	VkFormat GetDDSFormat( const MicroDDSPixelFormat& format ) const;
+
+	VkFormat GetDXGIFormat( const uint32_t dxgi_format ) const;
+
+public:
+	operator bool ( ) const;
+
+};
@@ -0,0 +1,106 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "MicroTexture.h"
+
+micro_struct MicroKTX2Header {
+
+	uint8_t Identifier[ 12 ];
+	uint32_t Format;
+	uint32_t TypeSize;
+	uint32_t Width;
+	uint32_t Height;
+	uint32_t Depth;
+	uint32_t LayerCount;
+	uint32_t FaceCount;
+	uint32_t LevelCount;
+	uint32_t Supercompression;
+	uint32_t DFDOffset;
+	uint32_t DFDLength;
+	uint32_t KVDOffset;
+	uint32_t KVDLength;
+	uint64_t SGDOffset;
+	uint64_t SGDLength;
+
+};
+
+micro_struct MicroKTX2Level {
+
+	uint64_t Offset;
+	uint64_t Length;
+	uint64_t UncompressedLength;
+
+};
+
+micro_struct MicroDDSPixelFormat {
+
+	uint32_t Size;
+	uint32_t Flags;
+	uint32_t FourCC;
+	uint32_t BitCount;
+	uint32_t RMask;
+	uint32_t GMask;
+	uint32_t BMask;
+	uint32_t AMask;
+
+};
+
+micro_struct MicroDDSHeader {
+
+	uint32_t Magic;
+	uint32_t Size;
+	uint32_t Flags;
+	uint32_t Height;
+	uint32_t Width;
+	uint32_t Pitch;
+	uint32_t Depth;
+	uint32_t MipCount;
+	uint32_t Reserved[ 11 ];
+	MicroDDSPixelFormat Format;
+	uint32_t Caps;
+	uint32_t Caps2;
+	uint32_t Caps3;
+	uint32_t Caps4;
+	uint32_t Reserved2;
+
+};
+
+micro_struct MicroDDSHeaderDX10 {
+
+	uint32_t Format;
+	uint32_t Dimension;
+	uint32_t MiscFlags;
+	uint32_t ArraySize;
+	uint32_t MiscFlags2;
+
+};
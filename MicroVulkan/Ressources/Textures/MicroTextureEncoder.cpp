@@ -0,0 +1,976 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "__micro_vulkan_pch.h"
+
+#if defined( __x86_64__ ) || defined( _M_X64 )
+#	define MICRO_ENCODER_X64
+#	include <immintrin.h>
+#	ifdef _MSC_VER
+#		include <intrin.h>
+#	endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	INTERNAL ===
+////////////////////////////////////////////////////////////////////////////////////////////
+constexpr uint32_t ivk_BC7Weights[ 16 ] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+constexpr float ivk_BC1Factors[ 4 ]	  = { 0.f, 1.f, 1.f / 3.f, 2.f / 3.f };
+constexpr float ivk_BC7Factors[ 16 ]  = { 
+	0.f / 64.f,  4.f / 64.f,  9.f / 64.f,  13.f / 64.f, 17.f / 64.f, 21.f / 64.f, 26.f / 64.f, 30.f / 64.f,
+	34.f / 64.f, 38.f / 64.f, 43.f / 64.f, 47.f / 64.f, 51.f / 64.f, 55.f / 64.f, 60.f / 64.f, 64.f / 64.f
+};
+
+uint32_t ivk_SelectIndicesScalar(
+	const uint8_t* pixels,
+	const uint8_t* palette,
+	const uint32_t palette_size,
+	const uint32_t channel_mask,
+	uint8_t* indices
+) {
+	auto error = (uint32_t)0;
+	auto pixel = (uint32_t)0;
+
+	while ( pixel < 16 ) {
+		auto best_error = UINT32_MAX;
+		auto best		= (uint32_t)0;
+		auto entry		= (uint32_t)0;
+
+		while ( entry < palette_size ) {
+			auto distance = (uint32_t)0;
+			auto channel  = (uint32_t)0;
+
+			while ( channel < 4 ) {
+				if ( ( channel_mask >> ( channel * 8 ) ) & 0xFF ) {
+					auto delta = (int32_t)pixels[ pixel * 4 + channel ] - (int32_t)palette[ entry * 4 + channel ];
+
+					distance += (uint32_t)( delta * delta );
+				}
+
+				channel += 1;
+			}
+
+			if ( distance < best_error ) {
+				best_error = distance;
+				best	   = entry;
+			}
+
+			entry += 1;
+		}
+
+		indices[ pixel ] = (uint8_t)best;
+		error			+= best_error;
+		pixel			+= 1;
+	}
+
+	return error;
+}
+
+#ifdef MICRO_ENCODER_X64
+micro_target( "sse4.1" )
+uint32_t ivk_SelectIndicesSSE41(
+	const uint8_t* pixels,
+	const uint8_t* palette,
+	const uint32_t palette_size,
+	const uint32_t channel_mask,
+	uint8_t* indices
+) {
+	alignas( 16 ) uint32_t lanes[ 4 ];
+	alignas( 16 ) uint32_t errors[ 4 ];
+
+	auto mask  = _mm_set1_epi32( (int)channel_mask );
+	auto zero  = _mm_setzero_si128( );
+	auto error = (uint32_t)0;
+	auto group = (uint32_t)0;
+
+	// Four pixels per register, squared distances are summed with madd + hadd.
+	while ( group < 4 ) {
+		auto colors		= _mm_and_si128( _mm_loadu_si128( micro_cast( pixels + group * 16, const __m128i* ) ), mask );
+		auto best_error = _mm_set1_epi32( INT32_MAX );
+		auto best		= _mm_setzero_si128( );
+		auto entry		= (uint32_t)0;
+
+		while ( entry < palette_size ) {
+			auto reference = (uint32_t)0;
+
+			memcpy( micro_ptr( reference ), palette + entry * 4, sizeof( uint32_t ) );
+
+			auto color	   = _mm_and_si128( _mm_set1_epi32( (int)reference ), mask );
+			auto delta	   = _mm_sub_epi8( _mm_max_epu8( colors, color ), _mm_min_epu8( colors, color ) );
+			auto low	   = _mm_unpacklo_epi8( delta, zero );
+			auto high	   = _mm_unpackhi_epi8( delta, zero );
+			auto distance  = _mm_hadd_epi32( _mm_madd_epi16( low, low ), _mm_madd_epi16( high, high ) );
+			auto is_better = _mm_cmplt_epi32( distance, best_error );
+
+			best_error = _mm_min_epi32( distance, best_error );
+			best	   = _mm_blendv_epi8( best, _mm_set1_epi32( (int)entry ), is_better );
+			entry	  += 1;
+		}
+
+		_mm_store_si128( micro_cast( lanes, __m128i* ), best );
+		_mm_store_si128( micro_cast( errors, __m128i* ), best_error );
+
+		for ( auto lane = 0u; lane < 4; lane++ ) {
+			indices[ group * 4 + lane ] = (uint8_t)lanes[ lane ];
+			error					   += errors[ lane ];
+		}
+
+		group += 1;
+	}
+
+	return error;
+}
+
+micro_target( "avx2" )
+uint32_t ivk_SelectIndicesAVX2(
+	const uint8_t* pixels,
+	const uint8_t* palette,
+	const uint32_t palette_size,
+	const uint32_t channel_mask,
+	uint8_t* indices
+) {
+	alignas( 32 ) uint32_t lanes[ 8 ];
+	alignas( 32 ) uint32_t errors[ 8 ];
+
+	auto mask  = _mm256_set1_epi32( (int)channel_mask );
+	auto zero  = _mm256_setzero_si256( );
+	auto error = (uint32_t)0;
+	auto group = (uint32_t)0;
+
+	// In-lane unpack and hadd keep the eight pixels in their original order.
+	while ( group < 2 ) {
+		auto colors		= _mm256_and_si256( _mm256_loadu_si256( micro_cast( pixels + group * 32, const __m256i* ) ), mask );
+		auto best_error = _mm256_set1_epi32( INT32_MAX );
+		auto best		= _mm256_setzero_si256( );
+		auto entry		= (uint32_t)0;
+
+		while ( entry < palette_size ) {
+			auto reference = (uint32_t)0;
+
+			memcpy( micro_ptr( reference ), palette + entry * 4, sizeof( uint32_t ) );
+
+			auto color	   = _mm256_and_si256( _mm256_set1_epi32( (int)reference ), mask );
+			auto delta	   = _mm256_sub_epi8( _mm256_max_epu8( colors, color ), _mm256_min_epu8( colors, color ) );
+			auto low	   = _mm256_unpacklo_epi8( delta, zero );
+			auto high	   = _mm256_unpackhi_epi8( delta, zero );
+			auto distance  = _mm256_hadd_epi32( _mm256_madd_epi16( low, low ), _mm256_madd_epi16( high, high ) );
+			auto is_better = _mm256_cmpgt_epi32( best_error, distance );
+
+			best_error = _mm256_min_epi32( distance, best_error );
+			best	   = _mm256_blendv_epi8( best, _mm256_set1_epi32( (int)entry ), is_better );
+			entry	  += 1;
+		}
+
+		_mm256_store_si256( micro_cast( lanes, __m256i* ), best );
+		_mm256_store_si256( micro_cast( errors, __m256i* ), best_error );
+
+		for ( auto lane = 0u; lane < 8; lane++ ) {
+			indices[ group * 8 + lane ] = (uint8_t)lanes[ lane ];
+			error					   += errors[ lane ];
+		}
+
+		group += 1;
+	}
+
+	return error;
+}
+#endif
+
+MicroTextureEncoderKernel ivk_GetEncoderKernel( micro_string& name ) {
+#	ifdef MICRO_ENCODER_X64
+#		ifdef _MSC_VER
+	int info[ 4 ];
+
+	__cpuid( info, 0 );
+
+	auto leaf_count  = info[ 0 ];
+
+	__cpuid( info, 1 );
+
+	auto has_sse41	 = ( ( info[ 2 ] >> 19 ) & 1 ) != 0;
+	auto has_avx	 = ( ( info[ 2 ] >> 28 ) & 1 ) != 0;
+	auto has_osxsave = ( ( info[ 2 ] >> 27 ) & 1 ) != 0;
+	auto has_avx2	 = false;
+
+	// AVX2 also needs the OS to save the upper YMM state on context switch.
+	if ( leaf_count >= 7 && has_avx && has_osxsave && ( _xgetbv( 0 ) & 6 ) == 6 ) {
+		__cpuidex( info, 7, 0 );
+
+		has_avx2 = ( ( info[ 1 ] >> 5 ) & 1 ) != 0;
+	}
+#		else
+	__builtin_cpu_init( );
+
+	auto has_sse41 = __builtin_cpu_supports( "sse4.1" ) != 0;
+	auto has_avx2  = __builtin_cpu_supports( "avx2" ) != 0;
+#		endif
+
+	if ( has_avx2 ) {
+		name = "AVX2";
+
+		return ivk_SelectIndicesAVX2;
+	} else if ( has_sse41 ) {
+		name = "SSE4.1";
+
+		return ivk_SelectIndicesSSE41;
+	}
+#	endif
+
+	name = "Scalar";
+
+	return ivk_SelectIndicesScalar;
+}
+
+void ivk_ComputeEndpoints(
+	const uint8_t* block,
+	const uint32_t channels,
+	const MicroTextureEncoderQuality quality,
+	float* start,
+	float* end
+) {
+	float minimum[ 4 ] = { 255.f, 255.f, 255.f, 255.f };
+	float maximum[ 4 ] = { 0.f, 0.f, 0.f, 0.f };
+	float mean[ 4 ]	   = { 0.f, 0.f, 0.f, 0.f };
+
+	for ( auto pixel = 0u; pixel < 16; pixel++ ) {
+		for ( auto channel = 0u; channel < channels; channel++ ) {
+			auto value = (float)block[ pixel * 4 + channel ];
+
+			minimum[ channel ]  = std::min( minimum[ channel ], value );
+			maximum[ channel ]  = std::max( maximum[ channel ], value );
+			mean[ channel ]	   += value / 16.f;
+		}
+	}
+
+	if ( quality == MicroTextureEncoderQuality::Fast ) {
+		// Bounding box inset by 1/16, cheap and good enough for smooth data.
+		for ( auto channel = 0u; channel < channels; channel++ ) {
+			auto inset = ( maximum[ channel ] - minimum[ channel ] ) / 16.f;
+
+			start[ channel ] = minimum[ channel ] + inset;
+			end[ channel ]	 = maximum[ channel ] - inset;
+		}
+
+		return;
+	}
+
+	float covariance[ 4 ][ 4 ] = { };
+	float axis[ 4 ]			   = { 0.f, 0.f, 0.f, 0.f };
+
+	for ( auto pixel = 0u; pixel < 16; pixel++ ) {
+		for ( auto row = 0u; row < channels; row++ ) {
+			for ( auto column = 0u; column < channels; column++ ) {
+				auto a = (float)block[ pixel * 4 + row ] - mean[ row ];
+				auto b = (float)block[ pixel * 4 + column ] - mean[ column ];
+
+				covariance[ row ][ column ] += a * b;
+			}
+		}
+	}
+
+	for ( auto channel = 0u; channel < channels; channel++ )
+		axis[ channel ] = maximum[ channel ] - minimum[ channel ] + 1.f;
+
+	// Power iteration converges on the principal axis of the block colors.
+	for ( auto iteration = 0u; iteration < 8; iteration++ ) {
+		float next[ 4 ] = { 0.f, 0.f, 0.f, 0.f };
+		auto norm		= 0.f;
+
+		for ( auto row = 0u; row < channels; row++ ) {
+			for ( auto column = 0u; column < channels; column++ )
+				next[ row ] += covariance[ row ][ column ] * axis[ column ];
+
+			norm = std::max( norm, std::abs( next[ row ] ) );
+		}
+
+		if ( norm < 1e-6f )
+			break;
+
+		for ( auto channel = 0u; channel < channels; channel++ )
+			axis[ channel ] = next[ channel ] / norm;
+	}
+
+	auto length = 0.f;
+
+	for ( auto channel = 0u; channel < channels; channel++ )
+		length += axis[ channel ] * axis[ channel ];
+
+	length = std::sqrt( length );
+
+	for ( auto channel = 0u; channel < channels; channel++ )
+		axis[ channel ] /= length;
+
+	auto lowest	 = 0.f;
+	auto highest = 0.f;
+
+	for ( auto pixel = 0u; pixel < 16; pixel++ ) {
+		auto projection = 0.f;
+
+		for ( auto channel = 0u; channel < channels; channel++ )
+			projection += ( (float)block[ pixel * 4 + channel ] - mean[ channel ] ) * axis[ channel ];
+
+		lowest	= std::min( lowest, projection );
+		highest = std::max( highest, projection );
+	}
+
+	for ( auto channel = 0u; channel < channels; channel++ ) {
+		start[ channel ] = std::clamp( mean[ channel ] + axis[ channel ] * lowest, 0.f, 255.f );
+		end[ channel ]	 = std::clamp( mean[ channel ] + axis[ channel ] * highest, 0.f, 255.f );
+	}
+}
+
+bool ivk_RefineEndpoints(
+	const uint8_t* block,
+	const uint32_t channels,
+	const uint8_t* indices,
+	const float* factors,
+	float* start,
+	float* end
+) {
+	float start_sum[ 4 ] = { 0.f, 0.f, 0.f, 0.f };
+	float end_sum[ 4 ]	 = { 0.f, 0.f, 0.f, 0.f };
+	auto aa				 = 0.f;
+	auto ab				 = 0.f;
+	auto bb				 = 0.f;
+
+	// Least squares fit of both endpoints for the current index assignment.
+	for ( auto pixel = 0u; pixel < 16; pixel++ ) {
+		auto b = factors[ indices[ pixel ] ];
+		auto a = 1.f - b;
+
+		aa += a * a;
+		ab += a * b;
+		bb += b * b;
+
+		for ( auto channel = 0u; channel < channels; channel++ ) {
+			start_sum[ channel ] += a * (float)block[ pixel * 4 + channel ];
+			end_sum[ channel ]	 += b * (float)block[ pixel * 4 + channel ];
+		}
+	}
+
+	auto determinant = aa * bb - ab * ab;
+
+	if ( std::abs( determinant ) < 1e-6f )
+		return false;
+
+	for ( auto channel = 0u; channel < channels; channel++ ) {
+		start[ channel ] = std::clamp( ( start_sum[ channel ] * bb - end_sum[ channel ] * ab ) / determinant, 0.f, 255.f );
+		end[ channel ]	 = std::clamp( ( end_sum[ channel ] * aa - start_sum[ channel ] * ab ) / determinant, 0.f, 255.f );
+	}
+
+	return true;
+}
+
+uint16_t ivk_Pack565( const float* color ) {
+	auto red   = (uint32_t)( color[ 0 ] * 31.f / 255.f + .5f );
+	auto green = (uint32_t)( color[ 1 ] * 63.f / 255.f + .5f );
+	auto blue  = (uint32_t)( color[ 2 ] * 31.f / 255.f + .5f );
+
+	return (uint16_t)( ( red << 11 ) | ( green << 5 ) | blue );
+}
+
+void ivk_Unpack565( const uint16_t color, uint8_t* output ) {
+	auto red   = ( color >> 11 ) & 0x1F;
+	auto green = ( color >> 5 ) & 0x3F;
+	auto blue  = color & 0x1F;
+
+	output[ 0 ] = (uint8_t)( ( red << 3 ) | ( red >> 2 ) );
+	output[ 1 ] = (uint8_t)( ( green << 2 ) | ( green >> 4 ) );
+	output[ 2 ] = (uint8_t)( ( blue << 3 ) | ( blue >> 2 ) );
+	output[ 3 ] = 255;
+}
+
+uint32_t ivk_PackBC1(
+	const MicroTextureEncoderKernel kernel,
+	const uint8_t* block,
+	float* start,
+	float* end,
+	uint8_t* indices,
+	uint64_t& packed
+) {
+	uint8_t palette[ 16 ];
+
+	auto color0 = ivk_Pack565( start );
+	auto color1 = ivk_Pack565( end );
+
+	// Four color mode requires color0 > color1, the opposite order means punch through alpha.
+	if ( color0 < color1 ) {
+		std::swap( color0, color1 );
+
+		for ( auto channel = 0u; channel < 3; channel++ )
+			std::swap( start[ channel ], end[ channel ] );
+	}
+
+	ivk_Unpack565( color0, palette );
+	ivk_Unpack565( color1, palette + 4 );
+
+	for ( auto channel = 0u; channel < 4; channel++ ) {
+		palette[ 8 + channel ]  = (uint8_t)( ( 2 * palette[ channel ] + palette[ 4 + channel ] + 1 ) / 3 );
+		palette[ 12 + channel ] = (uint8_t)( ( palette[ channel ] + 2 * palette[ 4 + channel ] + 1 ) / 3 );
+	}
+
+	auto error = kernel( block, palette, color0 == color1 ? 1 : 4, 0x00FFFFFF, indices );
+
+	packed = (uint64_t)color0 | ( (uint64_t)color1 << 16 );
+
+	for ( auto pixel = 0u; pixel < 16; pixel++ )
+		packed |= (uint64_t)indices[ pixel ] << ( 32 + pixel * 2 );
+
+	return error;
+}
+
+uint32_t ivk_PackBC4( const uint8_t* values, const uint8_t red0, const uint8_t red1, uint64_t& packed ) {
+	uint32_t palette[ 8 ] = { red0, red1 };
+
+	if ( red0 > red1 ) {
+		for ( auto step = 1u; step < 7; step++ )
+			palette[ step + 1 ] = ( ( 7 - step ) * red0 + step * red1 + 3 ) / 7;
+	} else {
+		for ( auto step = 1u; step < 5; step++ )
+			palette[ step + 1 ] = ( ( 5 - step ) * red0 + step * red1 + 2 ) / 5;
+
+		palette[ 6 ] = 0;
+		palette[ 7 ] = 255;
+	}
+
+	auto error = (uint32_t)0;
+
+	packed = (uint64_t)red0 | ( (uint64_t)red1 << 8 );
+
+	for ( auto pixel = 0u; pixel < 16; pixel++ ) {
+		auto best_error = UINT32_MAX;
+		auto best		= (uint32_t)0;
+
+		for ( auto entry = 0u; entry < 8; entry++ ) {
+			auto delta	  = (int32_t)values[ pixel ] - (int32_t)palette[ entry ];
+			auto distance = (uint32_t)( delta * delta );
+
+			if ( distance < best_error ) {
+				best_error = distance;
+				best	   = entry;
+			}
+		}
+
+		packed |= (uint64_t)best << ( 16 + pixel * 3 );
+		error  += best_error;
+	}
+
+	return error;
+}
+
+void ivk_WriteBits( uint8_t* output, uint32_t& position, const uint32_t value, const uint32_t count ) {
+	for ( auto bit = 0u; bit < count; bit++ ) {
+		if ( ( value >> bit ) & 1 )
+			output[ position / 8 ] |= (uint8_t)( 1 << ( position % 8 ) );
+
+		position += 1;
+	}
+}
+
+uint32_t ivk_PackBC7(
+	const MicroTextureEncoderKernel kernel,
+	const uint8_t* block,
+	float* start,
+	float* end,
+	uint8_t* indices,
+	uint8_t* output
+) {
+	uint32_t endpoints[ 2 ][ 4 ];
+	uint32_t parity[ 2 ];
+	uint8_t palette[ 64 ];
+
+	// Mode 6 stores 7 bit endpoints plus one shared p-bit per endpoint.
+	for ( auto endpoint = 0u; endpoint < 2; endpoint++ ) {
+		auto* source	= endpoint == 0 ? start : end;
+		auto best_error = std::numeric_limits<float>::max( );
+
+		for ( auto bit = 0u; bit < 2; bit++ ) {
+			uint32_t quantized[ 4 ];
+
+			auto error = 0.f;
+
+			for ( auto channel = 0u; channel < 4; channel++ ) {
+				auto value = (int32_t)( ( source[ channel ] - (float)bit ) * .5f + .5f );
+				auto delta = 0.f;
+
+				quantized[ channel ] = (uint32_t)std::clamp( value, 0, 127 );
+				delta				 = (float)( ( quantized[ channel ] << 1 ) | bit ) - source[ channel ];
+				error				+= delta * delta;
+			}
+
+			if ( error < best_error ) {
+				best_error		   = error;
+				parity[ endpoint ] = bit;
+
+				memcpy( endpoints[ endpoint ], quantized, sizeof( quantized ) );
+			}
+		}
+	}
+
+	for ( auto entry = 0u; entry < 16; entry++ ) {
+		auto weight = ivk_BC7Weights[ entry ];
+
+		for ( auto channel = 0u; channel < 4; channel++ ) {
+			auto color0 = ( endpoints[ 0 ][ channel ] << 1 ) | parity[ 0 ];
+			auto color1 = ( endpoints[ 1 ][ channel ] << 1 ) | parity[ 1 ];
+
+			palette[ entry * 4 + channel ] = (uint8_t)( ( ( 64 - weight ) * color0 + weight * color1 + 32 ) >> 6 );
+		}
+	}
+
+	auto error = kernel( block, palette, 16, 0xFFFFFFFF, indices );
+
+	// The anchor index drops its high bit, flip the endpoints so it stays below 8.
+	if ( indices[ 0 ] >= 8 ) {
+		std::swap( endpoints[ 0 ], endpoints[ 1 ] );
+		std::swap( parity[ 0 ], parity[ 1 ] );
+
+		for ( auto channel = 0u; channel < 4; channel++ )
+			std::swap( start[ channel ], end[ channel ] );
+
+		for ( auto pixel = 0u; pixel < 16; pixel++ )
+			indices[ pixel ] = (uint8_t)( 15 - indices[ pixel ] );
+	}
+
+	auto position = (uint32_t)0;
+
+	memset( output, 0, 16 );
+
+	ivk_WriteBits( output, position, 1 << 6, 7 );
+
+	for ( auto channel = 0u; channel < 4; channel++ ) {
+		ivk_WriteBits( output, position, endpoints[ 0 ][ channel ], 7 );
+		ivk_WriteBits( output, position, endpoints[ 1 ][ channel ], 7 );
+	}
+
+	ivk_WriteBits( output, position, parity[ 0 ], 1 );
+	ivk_WriteBits( output, position, parity[ 1 ], 1 );
+
+	for ( auto pixel = 0u; pixel < 16; pixel++ )
+		ivk_WriteBits( output, position, indices[ pixel ], pixel == 0 ? 3 : 4 );
+
+	return error;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+MicroTextureEncoderSpecification::MicroTextureEncoderSpecification( )
+	: MicroTextureEncoderSpecification{ VK_FORMAT_BC7_UNORM_BLOCK, { 0, 0 } }
+{ }
+
+MicroTextureEncoderSpecification::MicroTextureEncoderSpecification(
+	const VkFormat format,
+	const VkExtent2D& extent
+)
+	: MicroTextureEncoderSpecification{ format, MicroTextureEncoderQuality::Normal, extent, 1 }
+{ }
+
+MicroTextureEncoderSpecification::MicroTextureEncoderSpecification(
+	const VkFormat format,
+	const MicroTextureEncoderQuality quality,
+	const VkExtent2D& extent,
+	const uint32_t mip_levels
+)
+	: Format{ format },
+	Quality{ quality },
+	Extent{ extent },
+	MipLevels{ mip_levels }
+{ }
+
+MicroTextureEncoder::MicroTextureEncoder( )
+	: m_kernel{ NULL },
+	m_kernel_name{ NULL }
+{ 
+	m_kernel = ivk_GetEncoderKernel( m_kernel_name );
+}
+
+bool MicroTextureEncoder::Encode(
+	const MicroTextureEncoderSpecification& specification,
+	const uint8_t* pixels,
+	std::vector<uint8_t>& blocks
+) {
+	auto workers = MicroVulkanWorkerPool{ };
+
+	return Encode( workers, specification, pixels, blocks );
+}
+
+bool MicroTextureEncoder::Encode(
+	MicroVulkanWorkerPool& workers,
+	const MicroTextureEncoderSpecification& specification,
+	const uint8_t* pixels,
+	std::vector<uint8_t>& blocks
+) {
+	auto& extent = specification.Extent;
+
+	if ( 
+		pixels == NULL						  ||
+		extent.width == 0					  ||
+		extent.height == 0					  ||
+		specification.MipLevels == 0		  ||
+		!GetIsSupported( specification.Format )
+	)
+		return false;
+
+	auto properties	  = MicroTextureProperties{ specification.Format, VK_IMAGE_LAYOUT_UNDEFINED, { extent.width, extent.height, 1 } };
+	auto level_pixels = std::vector<uint8_t>{ };
+	auto next_pixels  = std::vector<uint8_t>{ };
+	auto* source	  = pixels;
+	auto offset		  = (uint64_t)0;
+	auto level		  = (uint32_t)0;
+
+	blocks.resize( GetEncodedLength( specification ) );
+
+	while ( level < specification.MipLevels ) {
+		auto level_extent  = properties.GetLevelExtent( level );
+		auto source_extent = VkExtent2D{ level_extent.width, level_extent.height };
+
+		EncodeLevel( workers, specification, source_extent, source, blocks.data( ) + offset );
+
+		offset += properties.GetLevelLength( level );
+		level  += 1;
+
+		if ( level < specification.MipLevels ) {
+			Downsample( source_extent, source, next_pixels );
+
+			std::swap( level_pixels, next_pixels );
+
+			source = level_pixels.data( );
+		}
+	}
+
+	return true;
+}
+
+bool MicroTextureEncoder::Create(
+	MicroVulkan& vulkan,
+	MicroVulkanWorkerPool& workers,
+	const MicroTextureEncoderSpecification& specification,
+	const uint8_t* pixels,
+	MicroTexture& texture
+) {
+	auto upload_context = MicroVulkanUploadContext{ };
+	auto state			= vulkan.AcquireUpload( upload_context );
+
+	if ( state ) {
+		state = Create( vulkan, upload_context, workers, specification, pixels, texture );
+		state = ( vulkan.SubmitUpload( upload_context ) == VK_SUCCESS ) && state;
+	}
+
+	return state;
+}
+
+bool MicroTextureEncoder::Create(
+	MicroVulkan& vulkan,
+	MicroVulkanUploadContext& upload_context,
+	MicroVulkanWorkerPool& workers,
+	const MicroTextureEncoderSpecification& specification,
+	const uint8_t* pixels,
+	MicroTexture& texture
+) {
+	auto& device	= vulkan.GetDevice( );
+	auto properties = device.GetFormatProperties( specification.Format );
+	auto blocks		= std::vector<uint8_t>{ };
+
+	if ( 
+		!( properties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT ) ||
+		!Encode( workers, specification, pixels, blocks )
+	)
+		return false;
+
+	auto& extent	  = specification.Extent;
+	auto texture_spec = MicroVulkanTextureSpecification{ 
+		MicroTextureProperties{
+			specification.Format, 
+			VK_IMAGE_LAYOUT_UNDEFINED, 
+			{ extent.width, extent.height, 1 }, 
+			specification.MipLevels, 
+			1 
+		}
+	};
+
+	texture_spec.Usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+
+	return  texture.Create( vulkan, texture_spec ) &&
+			texture.Fill( vulkan, upload_context, (uint32_t)blocks.size( ), blocks.data( ) );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+void MicroTextureEncoder::EncodeLevel(
+	MicroVulkanWorkerPool& workers,
+	const MicroTextureEncoderSpecification& specification,
+	const VkExtent2D& extent,
+	const uint8_t* pixels,
+	uint8_t* blocks
+) {
+	auto block_length = vk::GetFormatBlock( specification.Format ).Size;
+	auto columns	  = ( extent.width + BLOCK_DIMENSION - 1 ) / BLOCK_DIMENSION;
+	auto rows		  = ( extent.height + BLOCK_DIMENSION - 1 ) / BLOCK_DIMENSION;
+
+	workers.ParallelFor( rows, [ & ]( const uint32_t row ) {
+		uint8_t block[ BLOCK_PIXELS * 4 ];
+
+		for ( auto column = 0u; column < columns; column++ ) {
+			auto* output = blocks + ( (uint64_t)row * columns + column ) * block_length;
+
+			FetchBlock( extent, pixels, column * BLOCK_DIMENSION, row * BLOCK_DIMENSION, block );
+			EncodeBlock( specification, block, output );
+		}
+	} );
+}
+
+void MicroTextureEncoder::EncodeBlock(
+	const MicroTextureEncoderSpecification& specification,
+	const uint8_t* block,
+	uint8_t* output
+) {
+	switch ( specification.Format ) {
+		case VK_FORMAT_BC1_RGB_UNORM_BLOCK	:
+		case VK_FORMAT_BC1_RGB_SRGB_BLOCK	:
+		case VK_FORMAT_BC1_RGBA_UNORM_BLOCK :
+		case VK_FORMAT_BC1_RGBA_SRGB_BLOCK	: 
+			EncodeBC1( specification.Quality, block, output ); 
+			break;
+
+		case VK_FORMAT_BC3_UNORM_BLOCK :
+		case VK_FORMAT_BC3_SRGB_BLOCK  :
+			EncodeBC4( specification.Quality, block, 3, output );
+			EncodeBC1( specification.Quality, block, output + 8 );
+			break;
+
+		case VK_FORMAT_BC4_UNORM_BLOCK : 
+			EncodeBC4( specification.Quality, block, 0, output ); 
+			break;
+
+		case VK_FORMAT_BC5_UNORM_BLOCK :
+			EncodeBC4( specification.Quality, block, 0, output );
+			EncodeBC4( specification.Quality, block, 1, output + 8 );
+			break;
+
+		case VK_FORMAT_BC7_UNORM_BLOCK :
+		case VK_FORMAT_BC7_SRGB_BLOCK  : 
+			EncodeBC7( specification.Quality, block, output ); 
+			break;
+
+		default : break;
+	}
+}
+
+void MicroTextureEncoder::EncodeBC1(
+	const MicroTextureEncoderQuality quality,
+	const uint8_t* block,
+	uint8_t* output
+) {
+	float start[ 4 ];
+	float end[ 4 ];
+	uint8_t indices[ BLOCK_PIXELS ];
+
+	auto passes		= quality == MicroTextureEncoderQuality::High ? 3u : 1u;
+	auto best_error = UINT32_MAX;
+	auto best		= (uint64_t)0;
+	auto pass		= (uint32_t)0;
+
+	ivk_ComputeEndpoints( block, 3, quality, start, end );
+
+	while ( pass < passes ) {
+		auto packed = (uint64_t)0;
+		auto error	= ivk_PackBC1( m_kernel, block, start, end, indices, packed );
+
+		if ( error < best_error ) {
+			best_error = error;
+			best	   = packed;
+		}
+
+		pass += 1;
+
+		if ( best_error == 0 || !ivk_RefineEndpoints( block, 3, indices, ivk_BC1Factors, start, end ) )
+			break;
+	}
+
+	memcpy( output, micro_ptr( best ), sizeof( uint64_t ) );
+}
+
+void MicroTextureEncoder::EncodeBC4(
+	const MicroTextureEncoderQuality quality,
+	const uint8_t* block,
+	const uint32_t channel,
+	uint8_t* output
+) {
+	uint8_t values[ BLOCK_PIXELS ];
+
+	auto minimum	   = (uint8_t)255;
+	auto maximum	   = (uint8_t)0;
+	auto inner_minimum = (uint8_t)255;
+	auto inner_maximum = (uint8_t)0;
+
+	for ( auto pixel = 0u; pixel < BLOCK_PIXELS; pixel++ ) {
+		values[ pixel ] = block[ pixel * 4 + channel ];
+		minimum			= std::min( minimum, values[ pixel ] );
+		maximum			= std::max( maximum, values[ pixel ] );
+
+		if ( values[ pixel ] > 0 && values[ pixel ] < 255 ) {
+			inner_minimum = std::min( inner_minimum, values[ pixel ] );
+			inner_maximum = std::max( inner_maximum, values[ pixel ] );
+		}
+	}
+
+	auto best  = (uint64_t)0;
+	auto error = ivk_PackBC4( values, maximum, minimum, best );
+
+	// Six value mode keeps exact 0 and 255, it wins on blocks with hard extremes.
+	if ( quality != MicroTextureEncoderQuality::Fast && inner_minimum <= inner_maximum && error > 0 ) {
+		auto packed		 = (uint64_t)0;
+		auto inner_error = ivk_PackBC4( values, inner_minimum, inner_maximum, packed );
+
+		if ( inner_error < error )
+			best = packed;
+	}
+
+	memcpy( output, micro_ptr( best ), sizeof( uint64_t ) );
+}
+
+void MicroTextureEncoder::EncodeBC7(
+	const MicroTextureEncoderQuality quality,
+	const uint8_t* block,
+	uint8_t* output
+) {
+	float start[ 4 ];
+	float end[ 4 ];
+	uint8_t indices[ BLOCK_PIXELS ];
+	uint8_t packed[ 16 ];
+
+	auto passes		= quality == MicroTextureEncoderQuality::High ? 3u : 1u;
+	auto best_error = UINT32_MAX;
+	auto pass		= (uint32_t)0;
+
+	ivk_ComputeEndpoints( block, 4, quality, start, end );
+
+	while ( pass < passes ) {
+		auto error = ivk_PackBC7( m_kernel, block, start, end, indices, packed );
+
+		if ( error < best_error ) {
+			best_error = error;
+
+			memcpy( output, packed, sizeof( packed ) );
+		}
+
+		pass += 1;
+
+		if ( best_error == 0 || !ivk_RefineEndpoints( block, 4, indices, ivk_BC7Factors, start, end ) )
+			break;
+	}
+}
+
+void MicroTextureEncoder::FetchBlock(
+	const VkExtent2D& extent,
+	const uint8_t* pixels,
+	const uint32_t x,
+	const uint32_t y,
+	uint8_t* block
+) const {
+	// Edge blocks replicate the last row and column.
+	for ( auto row = 0u; row < BLOCK_DIMENSION; row++ ) {
+		auto source_y = std::min( y + row, extent.height - 1 );
+
+		for ( auto column = 0u; column < BLOCK_DIMENSION; column++ ) {
+			auto source_x = std::min( x + column, extent.width - 1 );
+			auto* source  = pixels + ( (uint64_t)source_y * extent.width + source_x ) * 4;
+
+			memcpy( block + ( row * BLOCK_DIMENSION + column ) * 4, source, 4 );
+		}
+	}
+}
+
+void MicroTextureEncoder::Downsample(
+	const VkExtent2D& extent,
+	const uint8_t* source,
+	std::vector<uint8_t>& destination
+) const {
+	auto width	= std::max( extent.width / 2, 1u );
+	auto height = std::max( extent.height / 2, 1u );
+
+	destination.resize( (uint64_t)width * height * 4 );
+
+	for ( auto y = 0u; y < height; y++ ) {
+		auto y0 = std::min( y * 2, extent.height - 1 );
+		auto y1 = std::min( y * 2 + 1, extent.height - 1 );
+
+		for ( auto x = 0u; x < width; x++ ) {
+			auto x0 = std::min( x * 2, extent.width - 1 );
+			auto x1 = std::min( x * 2 + 1, extent.width - 1 );
+
+			for ( auto channel = 0u; channel < 4; channel++ ) {
+				auto sum = (uint32_t)source[ ( (uint64_t)y0 * extent.width + x0 ) * 4 + channel ] +
+						   (uint32_t)source[ ( (uint64_t)y0 * extent.width + x1 ) * 4 + channel ] +
+						   (uint32_t)source[ ( (uint64_t)y1 * extent.width + x0 ) * 4 + channel ] +
+						   (uint32_t)source[ ( (uint64_t)y1 * extent.width + x1 ) * 4 + channel ];
+
+				destination[ ( (uint64_t)y * width + x ) * 4 + channel ] = (uint8_t)( ( sum + 2 ) / 4 );
+			}
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool MicroTextureEncoder::GetIsSupported( const VkFormat format ) const {
+	return  format == VK_FORMAT_BC1_RGB_UNORM_BLOCK  ||
+			format == VK_FORMAT_BC1_RGB_SRGB_BLOCK	 ||
+			format == VK_FORMAT_BC1_RGBA_UNORM_BLOCK ||
+			format == VK_FORMAT_BC1_RGBA_SRGB_BLOCK	 ||
+			format == VK_FORMAT_BC3_UNORM_BLOCK		 ||
+			format == VK_FORMAT_BC3_SRGB_BLOCK		 ||
+			format == VK_FORMAT_BC4_UNORM_BLOCK		 ||
+			format == VK_FORMAT_BC5_UNORM_BLOCK		 ||
+			format == VK_FORMAT_BC7_UNORM_BLOCK		 ||
+			format == VK_FORMAT_BC7_SRGB_BLOCK;
+}
+
+uint64_t MicroTextureEncoder::GetEncodedLength( 
+	const MicroTextureEncoderSpecification& specification 
+) const {
+	auto& extent	= specification.Extent;
+	auto properties = MicroTextureProperties{ specification.Format, VK_IMAGE_LAYOUT_UNDEFINED, { extent.width, extent.height, 1 } };
+	auto length		= (uint64_t)0;
+	auto level		= specification.MipLevels;
+
+	while ( level-- > 0 )
+		length += properties.GetLevelLength( level );
+
+	return length;
+}
+
+micro_string MicroTextureEncoder::GetKernelName( ) const {
+	return m_kernel_name;
+}
@@ -0,0 +1,174 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "MicroTextureContainer.h"
+
+typedef uint32_t ( *MicroTextureEncoderKernel )( 
+	const uint8_t* pixels, 
+	const uint8_t* palette, 
+	const uint32_t palette_size, 
+	const uint32_t channel_mask, 
+	uint8_t* indices 
+);
+
+micro_enum_class MicroTextureEncoderQuality : uint32_t {
+
+	Fast = 0,
+	Normal,
+	High
+
+};
+
+micro_struct MicroTextureEncoderSpecification {
+
+	VkFormat Format;
+	MicroTextureEncoderQuality Quality;
+	VkExtent2D Extent;
+	uint32_t MipLevels;
+
+	MicroTextureEncoderSpecification( );
+
+	MicroTextureEncoderSpecification( 
+		const VkFormat format,
+		const VkExtent2D& extent
+	);
+
+	MicroTextureEncoderSpecification( 
+		const VkFormat format,
+		const MicroTextureEncoderQuality quality,
+		const VkExtent2D& extent,
+		const uint32_t mip_levels
+	);
+
+};
+
+micro_class MicroTextureEncoder final {
+
+	constexpr static uint32_t BLOCK_DIMENSION = 4;
+	constexpr static uint32_t BLOCK_PIXELS	  = BLOCK_DIMENSION * BLOCK_DIMENSION;
+
+private:
+	MicroTextureEncoderKernel m_kernel;
+	micro_string m_kernel_name;
+
+public:
+	MicroTextureEncoder( );
+
+	~MicroTextureEncoder( ) = default;
+
+	bool Encode( 
+		const MicroTextureEncoderSpecification& specification,
+		const uint8_t* pixels,
+		std::vector<uint8_t>& blocks
+	);
+
+	bool Encode( 
+		MicroVulkanWorkerPool& workers,
+		const MicroTextureEncoderSpecification& specification,
+		const uint8_t* pixels,
+		std::vector<uint8_t>& blocks
+	);
+
+	bool Create(
+		MicroVulkan& vulkan,
+		MicroVulkanWorkerPool& workers,
+		const MicroTextureEncoderSpecification& specification,
+		const uint8_t* pixels,
+		MicroTexture& texture
+	);
+
+	bool Create(
+		MicroVulkan& vulkan,
+		MicroVulkanUploadContext& upload_context,
+		MicroVulkanWorkerPool& workers,
+		const MicroTextureEncoderSpecification& specification,
+		const uint8_t* pixels,
+		MicroTexture& texture
+	);
+
+private:
+	void EncodeLevel(
+		MicroVulkanWorkerPool& workers,
+		const MicroTextureEncoderSpecification& specification,
+		const VkExtent2D& extent,
+		const uint8_t* pixels,
+		uint8_t* blocks
+	);
+
+	void EncodeBlock( 
+		const MicroTextureEncoderSpecification& specification,
+		const uint8_t* block,
+		uint8_t* output
+	);
+
+	void EncodeBC1( 
+		const MicroTextureEncoderQuality quality,
+		const uint8_t* block,
+		uint8_t* output
+	);
+
+	void EncodeBC4( 
+		const MicroTextureEncoderQuality quality,
+		const uint8_t* block,
+		const uint32_t channel,
+		uint8_t* output
+	);
+
+	void EncodeBC7( 
+		const MicroTextureEncoderQuality quality,
+		const uint8_t* block,
+		uint8_t* output
+	);
+
+	void FetchBlock(
+		const VkExtent2D& extent,
+		const uint8_t* pixels,
+		const uint32_t x,
+		const uint32_t y,
+		uint8_t* block
+	) const;
+
+	void Downsample(
+		const VkExtent2D& extent,
+		const uint8_t* source,
+		std::vector<uint8_t>& destination
+	) const;
+
+public:
+	bool GetIsSupported( const VkFormat format ) const;
+
+	uint64_t GetEncodedLength( const MicroTextureEncoderSpecification& specification ) const;
+
+	micro_string GetKernelName( ) const;
+
+};
@@ -76,3 +76,26 @@ MicroTextureProperties::MicroTextureProperties(
     MipLevels{ mip_levels },
 	ArrayLayers{ array_layers }
 { }
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+VkExtent3D MicroTextureProperties::GetLevelExtent( const uint32_t level ) const {
+    auto extent = Extent;
+
+    extent.width  = std::max( extent.width >> level, 1u );
+    extent.height = std::max( extent.height >> level, 1u );
+    extent.depth  = std::max( extent.depth >> level, 1u );
+
+    return extent;
+}
+
+VkDeviceSize MicroTextureProperties::GetLevelLength( const uint32_t level ) const {
+    auto block  = vk::GetFormatBlock( Format );
+    auto extent = GetLevelExtent( level );
+    auto width  = (VkDeviceSize)( extent.width + block.Width - 1 ) / block.Width;
+    auto height = (VkDeviceSize)( extent.height + block.Height - 1 ) / block.Height;
+
+    // Large levels exceed 4 GiB, the whole product is kept on 64 bits.
+    return width * height * extent.depth * block.Size;
+}
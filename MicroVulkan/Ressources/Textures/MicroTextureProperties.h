@@ -64,4 +64,8 @@ micro_struct MicroTextureProperties {
 		const uint32_t array_layers
 	);
 
+	VkExtent3D GetLevelExtent( const uint32_t level ) const;
+
+	VkDeviceSize GetLevelLength( const uint32_t level ) const;
+
 };
@@ -0,0 +1,447 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "__micro_vulkan_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+MicroTextureStream::MicroTextureStream( )
+	: Container{ },
+	Texture{ },
+	Pending{ },
+	TailLevel{ 0 },
+	ResidentLevel{ 0 },
+	PendingLevel{ UINT32_MAX },
+	RequestedLevel{ 0 },
+	Generation{ 0 },
+	RequestFrame{ 0 },
+	Priority{ 0.f }
+{ }
+
+MicroTextureStreamer::MicroTextureStreamer( )
+	: m_streams{ },
+	m_uploads{ },
+	m_releases{ },
+	m_budget{ 0 },
+	m_usage{ 0 },
+	m_frame{ 0 }
+{ }
+
+bool MicroTextureStreamer::Create( const uint64_t budget ) {
+	m_budget = budget;
+
+	return m_budget > 0;
+}
+
+uint32_t MicroTextureStreamer::Register( MicroVulkan& vulkan, const std::string& path ) {
+	auto upload_context = MicroVulkanUploadContext{ };
+	auto stream_id		= UINT32_MAX;
+
+	if ( vulkan.AcquireUpload( upload_context ) ) {
+		stream_id = Register( vulkan, upload_context, path );
+
+		if ( vulkan.SubmitUpload( upload_context ) != VK_SUCCESS )
+			stream_id = UINT32_MAX;
+	}
+
+	return stream_id;
+}
+
+uint32_t MicroTextureStreamer::Register(
+	MicroVulkan& vulkan,
+	MicroVulkanUploadContext& upload_context,
+	const std::string& path
+) {
+	auto& stream = m_streams.emplace_back( );
+
+	// Only the mip tail is loaded up front, finer levels wait for requests.
+	// A tail that doesn't fit the budget is refused, eviction only happens
+	// on Update.
+	if ( stream.Container.Open( path ) ) {
+		stream.TailLevel	  = GetTailLevel( stream.Container );
+		stream.ResidentLevel  = stream.TailLevel;
+		stream.RequestedLevel = stream.TailLevel;
+		stream.RequestFrame	  = m_frame;
+
+		auto length = stream.Container.GetResidentLength( stream.TailLevel );
+
+		if ( m_usage + length <= m_budget && stream.Container.Create( vulkan, upload_context, stream.Texture, stream.TailLevel ) ) {
+			m_usage += length;
+
+			return (uint32_t)m_streams.size( ) - 1;
+		}
+	}
+
+	stream.Texture.Destroy( vulkan );
+
+	m_streams.pop_back( );
+
+	return UINT32_MAX;
+}
+
+void MicroTextureStreamer::Request( const uint32_t stream_id, const float screen_size ) {
+	if ( stream_id >= GetStreamCount( ) )
+		return;
+
+	auto dimension = (float)GetFullDimension( m_streams[ stream_id ] );
+	auto level	   = (uint32_t)0;
+
+	// Every level halves the footprint, keep the first one that still covers the screen size.
+	while ( dimension * .5f >= screen_size && dimension > 1.f ) {
+		dimension *= .5f;
+		level	  += 1;
+	}
+
+	Request( stream_id, level, screen_size );
+}
+
+void MicroTextureStreamer::Request(
+	const uint32_t stream_id,
+	const uint32_t level,
+	const float priority
+) {
+	if ( stream_id >= GetStreamCount( ) )
+		return;
+
+	auto& stream = m_streams[ stream_id ];
+	auto target	 = std::min( level, stream.TailLevel );
+
+	if ( stream.RequestFrame != m_frame ) {
+		stream.RequestedLevel = target;
+		stream.Priority		  = priority;
+		stream.RequestFrame	  = m_frame;
+	} else {
+		stream.RequestedLevel = std::min( stream.RequestedLevel, target );
+		stream.Priority		  = std::max( stream.Priority, priority );
+	}
+}
+
+void MicroTextureStreamer::Feedback( const uint32_t* levels, const uint32_t count ) {
+	auto stream_id = (uint32_t)0;
+	auto limit	   = std::min( count, GetStreamCount( ) );
+
+	while ( stream_id < limit ) {
+		auto level = levels[ stream_id ];
+
+		// Feedback entries hold the finest mip sampled by the GPU, UINT32_MAX when unseen.
+		if ( level != UINT32_MAX ) {
+			auto dimension = GetFullDimension( m_streams[ stream_id ] );
+
+			Request( stream_id, level, (float)std::max( dimension >> std::min( level, 31u ), 1u ) );
+		}
+
+		stream_id += 1;
+	}
+}
+
+uint32_t MicroTextureStreamer::Update( MicroVulkan& vulkan ) {
+	auto candidates = std::vector<uint32_t>{ };
+	auto stream_id	= (uint32_t)0;
+	auto streamed	= (uint32_t)0;
+
+	m_frame += 1;
+
+	Publish( vulkan, false );
+	Release( vulkan, false );
+
+	while ( stream_id < GetStreamCount( ) ) {
+		auto& stream = m_streams[ stream_id ];
+
+		if ( m_frame - stream.RequestFrame > REQUEST_TIMEOUT ) {
+			stream.RequestedLevel = stream.TailLevel;
+			stream.Priority		  = 0.f;
+		}
+
+		if ( stream.RequestedLevel < stream.ResidentLevel && stream.PendingLevel == UINT32_MAX )
+			candidates.emplace_back( stream_id );
+
+		stream_id += 1;
+	}
+
+	if ( candidates.empty( ) )
+		return 0;
+
+	std::sort( 
+		candidates.begin( ), 
+		candidates.end( ), 
+		[ this ]( const uint32_t left, const uint32_t right ) { 
+			return m_streams[ left ].Priority > m_streams[ right ].Priority; 
+		} 
+	);
+
+	auto& upload = m_uploads.emplace_back( );
+
+	if ( !vulkan.AcquireUpload( upload.Context ) ) {
+		m_uploads.pop_back( );
+
+		return 0;
+	}
+
+	// One level per texture and frame, so a burst of requests never stalls a frame.
+	for ( auto candidate : candidates ) {
+		auto& stream = m_streams[ candidate ];
+
+		if ( streamed >= STREAM_LIMIT )
+			break;
+
+		auto level	   = stream.ResidentLevel - 1;
+		auto growth	   = stream.Container.GetResidentLength( level ) - stream.Container.GetResidentLength( stream.ResidentLevel );
+		auto available = m_budget > m_usage ? m_budget - m_usage : 0;
+
+		if ( growth > available && !Evict( vulkan, upload, stream, growth - available ) )
+			continue;
+
+		if ( Stream( vulkan, upload, stream, level ) )
+			streamed += 1;
+	}
+
+	// The frame never waits on the upload, the new textures are published by
+	// a later Update once its fence has signaled.
+	if ( vulkan.DispatchUpload( upload.Context ) != VK_SUCCESS ) {
+		for ( auto* stream : upload.Streams )
+			Discard( vulkan, micro_ref( stream ) );
+
+		for ( auto& texture : upload.Discards )
+			texture.Destroy( vulkan );
+
+		m_uploads.pop_back( );
+
+		return 0;
+	}
+
+	return streamed;
+}
+
+void MicroTextureStreamer::Destroy( MicroVulkan& vulkan ) {
+	Publish( vulkan, true );
+
+	for ( auto& stream : m_streams ) {
+		stream.Texture.Destroy( vulkan );
+		stream.Container.Close( );
+	}
+
+	Release( vulkan, true );
+
+	m_streams.clear( );
+
+	m_usage = 0;
+	m_frame = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool MicroTextureStreamer::Stream(
+	MicroVulkan& vulkan,
+	MicroTextureStreamUpload& upload,
+	MicroTextureStream& stream,
+	const uint32_t level
+) {
+	// Every level is read again from the mapped container, the current image
+	// is still sampled by frames in flight so it's never touched here.
+	if ( !stream.Container.Create( vulkan, upload.Context, stream.Pending, level ) ) {
+		// Commands may already reference the image, it can only go once the
+		// upload has retired.
+		upload.Discards.emplace_back( stream.Pending );
+
+		stream.Pending = { };
+
+		return false;
+	}
+
+	m_usage -= stream.Container.GetResidentLength( stream.ResidentLevel );
+	m_usage += stream.Container.GetResidentLength( level );
+
+	stream.PendingLevel = level;
+
+	upload.Streams.emplace_back( micro_ptr( stream ) );
+
+	return true;
+}
+
+bool MicroTextureStreamer::Evict(
+	MicroVulkan& vulkan,
+	MicroTextureStreamUpload& upload,
+	const MicroTextureStream& requester,
+	const uint64_t length
+) {
+	auto victims = std::vector<MicroTextureStream*>{ };
+	auto freed	 = (uint64_t)0;
+
+	// Textures holding finer levels than requested go first, then lower priorities.
+	for ( auto& stream : m_streams ) {
+		if ( 
+			micro_ptr( stream ) != micro_ptr( requester ) &&
+			stream.PendingLevel == UINT32_MAX			  &&
+			stream.ResidentLevel < stream.TailLevel		  &&
+			( stream.RequestedLevel > stream.ResidentLevel || stream.Priority < requester.Priority )
+		)
+			victims.emplace_back( micro_ptr( stream ) );
+	}
+
+	std::sort( 
+		victims.begin( ), 
+		victims.end( ), 
+		[ ]( const MicroTextureStream* left, const MicroTextureStream* right ) {
+			auto left_excess  = left->RequestedLevel > left->ResidentLevel;
+			auto right_excess = right->RequestedLevel > right->ResidentLevel;
+
+			if ( left_excess != right_excess )
+				return left_excess;
+
+			return left->Priority < right->Priority;
+		}
+	);
+
+	for ( auto* victim : victims ) {
+		auto level	= std::max( victim->RequestedLevel, victim->ResidentLevel + 1 );
+		auto before = victim->Container.GetResidentLength( victim->ResidentLevel );
+
+		if ( freed >= length )
+			break;
+
+		if ( Stream( vulkan, upload, micro_ref( victim ), level ) )
+			freed += before - victim->Container.GetResidentLength( level );
+	}
+
+	return freed >= length;
+}
+
+void MicroTextureStreamer::Discard( MicroVulkan& vulkan, MicroTextureStream& stream ) {
+	m_usage -= stream.Container.GetResidentLength( stream.PendingLevel );
+	m_usage += stream.Container.GetResidentLength( stream.ResidentLevel );
+
+	stream.Pending.Destroy( vulkan );
+
+	stream.Pending		= { };
+	stream.PendingLevel = UINT32_MAX;
+}
+
+void MicroTextureStreamer::Publish( MicroVulkan& vulkan, const bool force ) {
+	while ( !m_uploads.empty( ) ) {
+		auto& upload = m_uploads.front( );
+		auto result	 = vulkan.ReleaseUpload( upload.Context, force ? UINT64_MAX : 0 );
+
+		if ( result == VK_TIMEOUT )
+			break;
+
+		// The old image is kept alive until every frame in flight that may
+		// sample it has retired.
+		for ( auto* stream : upload.Streams ) {
+			if ( result != VK_SUCCESS ) {
+				Discard( vulkan, micro_ref( stream ) );
+
+				continue;
+			}
+
+			auto& release = m_releases.emplace_back( );
+
+			release.Texture = stream->Texture;
+			release.Frame	= m_frame;
+
+			stream->Texture		  = stream->Pending;
+			stream->ResidentLevel = stream->PendingLevel;
+			stream->Generation	 += 1;
+			stream->Pending		  = { };
+			stream->PendingLevel  = UINT32_MAX;
+		}
+
+		for ( auto& texture : upload.Discards )
+			texture.Destroy( vulkan );
+
+		m_uploads.pop_front( );
+	}
+}
+
+void MicroTextureStreamer::Release( MicroVulkan& vulkan, const bool force ) {
+	auto frame_delay = (uint64_t)vulkan.GetFrameCount( ) + 1;
+
+	while ( !m_releases.empty( ) && ( force || m_releases.front( ).Frame + frame_delay <= m_frame ) ) {
+		m_releases.front( ).Texture.Destroy( vulkan );
+		m_releases.pop_front( );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+const MicroTexture& MicroTextureStreamer::Get( const uint32_t stream_id ) const {
+	micro_assert( stream_id < GetStreamCount( ), "Stream ID is out of bound" );
+
+	return m_streams[ stream_id ].Texture;
+}
+
+uint32_t MicroTextureStreamer::GetResidentLevel( const uint32_t stream_id ) const {
+	return stream_id < GetStreamCount( ) ? m_streams[ stream_id ].ResidentLevel : UINT32_MAX;
+}
+
+uint32_t MicroTextureStreamer::GetGeneration( const uint32_t stream_id ) const {
+	return stream_id < GetStreamCount( ) ? m_streams[ stream_id ].Generation : 0;
+}
+
+uint32_t MicroTextureStreamer::GetStreamCount( ) const {
+	return (uint32_t)m_streams.size( );
+}
+
+uint64_t MicroTextureStreamer::GetBudget( ) const {
+	return m_budget;
+}
+
+uint64_t MicroTextureStreamer::GetUsage( ) const {
+	return m_usage;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t MicroTextureStreamer::GetTailLevel( const MicroTextureContainer& container ) const {
+	auto& properties = container.GetSpecification( ).Properties;
+	auto level_count = container.GetLevelCount( );
+	auto level		 = (uint32_t)0;
+
+	while ( level + 1 < level_count ) {
+		auto extent = properties.GetLevelExtent( level );
+
+		if ( std::max( extent.width, extent.height ) <= TAIL_DIMENSION )
+			break;
+
+		level += 1;
+	}
+
+	return level;
+}
+
+uint32_t MicroTextureStreamer::GetFullDimension( const MicroTextureStream& stream ) const {
+	auto& extent = stream.Container.GetSpecification( ).Properties.Extent;
+
+	return std::max( extent.width, extent.height );
+}
@@ -0,0 +1,155 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "MicroTextureEncoder.h"
+
+micro_struct MicroTextureStream {
+
+	MicroTextureContainer Container;
+	MicroTexture Texture;
+	MicroTexture Pending;
+	uint32_t TailLevel;
+	uint32_t ResidentLevel;
+	uint32_t PendingLevel;
+	uint32_t RequestedLevel;
+	uint32_t Generation;
+	uint64_t RequestFrame;
+	float Priority;
+
+	MicroTextureStream( );
+
+};
+
+micro_struct MicroTextureStreamUpload {
+
+	MicroVulkanUploadContext Context;
+	std::vector<MicroTextureStream*> Streams;
+	std::vector<MicroTexture> Discards;
+
+};
+
+micro_struct MicroTextureStreamRelease {
+
+	MicroTexture Texture;
+	uint64_t Frame;
+
+};
+
+micro_class MicroTextureStreamer final {
+
+	constexpr static uint32_t TAIL_DIMENSION  = 64;
+	constexpr static uint32_t REQUEST_TIMEOUT = 120;
+	constexpr static uint32_t STREAM_LIMIT	  = 4;
+
+private:
+	std::deque<MicroTextureStream> m_streams;
+	std::deque<MicroTextureStreamUpload> m_uploads;
+	std::deque<MicroTextureStreamRelease> m_releases;
+	uint64_t m_budget;
+	uint64_t m_usage;
+	uint64_t m_frame;
+
+public:
+	MicroTextureStreamer( );
+
+	~MicroTextureStreamer( ) = default;
+
+	bool Create( const uint64_t budget );
+
+	uint32_t Register( MicroVulkan& vulkan, const std::string& path );
+
+	uint32_t Register( 
+		MicroVulkan& vulkan, 
+		MicroVulkanUploadContext& upload_context,
+		const std::string& path 
+	);
+
+	void Request( const uint32_t stream_id, const float screen_size );
+
+	void Request( 
+		const uint32_t stream_id, 
+		const uint32_t level, 
+		const float priority 
+	);
+
+	void Feedback( const uint32_t* levels, const uint32_t count );
+
+	uint32_t Update( MicroVulkan& vulkan );
+
+	void Destroy( MicroVulkan& vulkan );
+
+private:
+	bool Stream(
+		MicroVulkan& vulkan,
+		MicroTextureStreamUpload& upload,
+		MicroTextureStream& stream,
+		const uint32_t level
+	);
+
+	bool Evict(
+		MicroVulkan& vulkan,
+		MicroTextureStreamUpload& upload,
+		const MicroTextureStream& requester,
+		const uint64_t length
+	);
+
+	void Discard( MicroVulkan& vulkan, MicroTextureStream& stream );
+
+	/**
+	 * Publish function
+	 * @note : Swap in the textures of every upload whose fence signaled, in
+	 *		   submission order. Force waits for all of them.
+	 **/
+	void Publish( MicroVulkan& vulkan, const bool force );
+
+	void Release( MicroVulkan& vulkan, const bool force );
+
+public:
+	const MicroTexture& Get( const uint32_t stream_id ) const;
+
+	uint32_t GetResidentLevel( const uint32_t stream_id ) const;
+
+	uint32_t GetGeneration( const uint32_t stream_id ) const;
+
+	uint32_t GetStreamCount( ) const;
+
+	uint64_t GetBudget( ) const;
+
+	uint64_t GetUsage( ) const;
+
+private:
+	uint32_t GetTailLevel( const MicroTextureContainer& container ) const;
+
+	uint32_t GetFullDimension( const MicroTextureStream& stream ) const;
+
+};
@@ -51,16 +51,20 @@ bool MicroVulkanTexture::Create( const MicroVulkanSwapchainImage& image ) {
 bool MicroVulkanTexture::Create( 
 	const MicroVulkanDevice& device,
 	const MicroVulkanQueues& queues,
+    MicroVulkanTextureCache& cache,
     const MicroVulkanTextureSpecification& specification
 ) {
-    return  CreateImage( device, queues, specification ) &&
-            CreateStorage( device )                      &&
-			CreateImageView( device, specification )     &&
-			CreateImageSampler( device, specification );
+    return  CreateImage( device, queues, specification )      &&
+            CreateStorage( device )                           &&
+			CreateImageView( device, specification )          &&
+			CreateImageSampler( device, cache, specification );
 }
 
-void MicroVulkanTexture::Destroy( const MicroVulkanDevice& device ) {
-    vk::DestroyImageSampler( device, m_sampler );
+void MicroVulkanTexture::Destroy(
+    const MicroVulkanDevice& device,
+    MicroVulkanTextureCache& cache
+) {
+    cache.ReleaseSampler( device, m_sampler );
     vk::DestroyImageView( device, m_view );
     vk::DeallocateMemory( device, m_memory );
     vk::DestroyImage( device, m_image );
@@ -75,7 +79,7 @@ bool MicroVulkanTexture::CreateImage(
 
     image_spec.sType         = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
     image_spec.pNext         = VK_NULL_HANDLE;
-    image_spec.flags         = VK_UNUSED_FLAG;
+    image_spec.flags         = specification.IsCubemap ? VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT : VK_UNUSED_FLAG;
     image_spec.imageType     = specification.Type;
     image_spec.format        = specification.Properties.Format;
     image_spec.extent        = specification.Properties.Extent;
@@ -84,7 +88,7 @@ bool MicroVulkanTexture::CreateImage(
     image_spec.samples       = specification.Samples;
     image_spec.tiling        = VK_IMAGE_TILING_OPTIMAL;
     image_spec.usage         = specification.Usage;
-    image_spec.initialLayout = VK_IMAGE_LAYOUT_GENERAL;
+    image_spec.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
     
     GetQueueSharingPolicy( queues, image_spec );
     
@@ -127,13 +131,14 @@ bool MicroVulkanTexture::CreateImageView(
 
 bool MicroVulkanTexture::CreateImageSampler(
 	const MicroVulkanDevice& device,
+    MicroVulkanTextureCache& cache,
     const MicroVulkanTextureSpecification& specification
 ) {
-    auto sampler_spec = VkSamplerCreateInfo{ };
-    auto result = VK_SUCCESS;
+    auto sampler_spec = GetSamplerSpec( specification );
+    auto result       = VK_SUCCESS;
 
     if ( specification.UseSampler == VK_TRUE )
-        result = vk::CreateImageSampler( device, sampler_spec, m_sampler );
+        result = cache.AcquireSampler( device, sampler_spec, m_sampler );
 
     return result == VK_SUCCESS;
 }
@@ -173,14 +178,13 @@ VkImageViewType MicroVulkanTexture::GetImageViewType(
 
     if ( specification.Type == VK_IMAGE_TYPE_1D )
         view_type = specification.Properties.ArrayLayers == 1 ? VK_IMAGE_VIEW_TYPE_1D : VK_IMAGE_VIEW_TYPE_1D_ARRAY;
-    else if ( specification.Type == VK_IMAGE_TYPE_2D )
-        view_type = specification.Properties.ArrayLayers == 1 ? VK_IMAGE_VIEW_TYPE_2D : VK_IMAGE_VIEW_TYPE_2D_ARRAY;
-    else if ( specification.Type == VK_IMAGE_TYPE_3D ) {
+    else if ( specification.Type == VK_IMAGE_TYPE_2D ) {
         if ( specification.IsCubemap )
-            view_type = specification.Properties.ArrayLayers == 1 ? VK_IMAGE_VIEW_TYPE_CUBE : VK_IMAGE_VIEW_TYPE_CUBE_ARRAY;
+            view_type = specification.Properties.ArrayLayers == 6 ? VK_IMAGE_VIEW_TYPE_CUBE : VK_IMAGE_VIEW_TYPE_CUBE_ARRAY;
         else
-            view_type = VK_IMAGE_VIEW_TYPE_3D;
-    }
+            view_type = specification.Properties.ArrayLayers == 1 ? VK_IMAGE_VIEW_TYPE_2D : VK_IMAGE_VIEW_TYPE_2D_ARRAY;
+    } else if ( specification.Type == VK_IMAGE_TYPE_3D )
+        view_type = VK_IMAGE_VIEW_TYPE_3D;
 
     return view_type;
 }
@@ -207,6 +211,36 @@ VkImageAspectFlagBits MicroVulkanTexture::GetImageAspect(
     return aspect;
 }
 
+VkSamplerCreateInfo MicroVulkanTexture::GetSamplerSpec(
+    const MicroVulkanTextureSpecification& specification
+) const {
+    auto sampler_spec = specification.Sampler;
+
+    if ( sampler_spec.sType == VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO )
+        return sampler_spec;
+
+    sampler_spec.sType                   = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+    sampler_spec.pNext                   = VK_NULL_HANDLE;
+    sampler_spec.flags                   = VK_UNUSED_FLAG;
+    sampler_spec.magFilter               = VK_FILTER_LINEAR;
+    sampler_spec.minFilter               = VK_FILTER_LINEAR;
+    sampler_spec.mipmapMode              = VK_SAMPLER_MIPMAP_MODE_LINEAR;
+    sampler_spec.addressModeU            = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+    sampler_spec.addressModeV            = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+    sampler_spec.addressModeW            = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+    sampler_spec.mipLodBias              = 0.f;
+    sampler_spec.anisotropyEnable        = VK_FALSE;
+    sampler_spec.maxAnisotropy           = 1.f;
+    sampler_spec.compareEnable           = VK_FALSE;
+    sampler_spec.compareOp               = VK_COMPARE_OP_NEVER;
+    sampler_spec.minLod                  = 0.f;
+    sampler_spec.maxLod                  = VK_LOD_CLAMP_NONE;
+    sampler_spec.borderColor             = VK_BORDER_COLOR_INT_OPAQUE_BLACK;
+    sampler_spec.unnormalizedCoordinates = VK_FALSE;
+
+    return sampler_spec;
+}
+
 MicroVulkanTexture::operator VkImage ( ) const {
     return GetImage( );
 }
@@ -31,7 +31,7 @@
 
 #pragma once
 
-#include "MicroVulkanTextureSpecification.h"
+#include "MicroVulkanTextureCache.h"
 
 micro_class MicroVulkanTexture {
 
@@ -51,10 +51,14 @@ public:
 	bool Create(
 		const MicroVulkanDevice& device,
 		const MicroVulkanQueues& queues,
+		MicroVulkanTextureCache& cache,
 		const MicroVulkanTextureSpecification& specification
 	);
 
-	void Destroy( const MicroVulkanDevice& device );
+	void Destroy(
+		const MicroVulkanDevice& device,
+		MicroVulkanTextureCache& cache
+	);
 
 private:
 	bool CreateImage(
@@ -74,6 +78,7 @@ private:
 
 	bool CreateImageSampler( 
 		const MicroVulkanDevice& device,
+		MicroVulkanTextureCache& cache,
 		const MicroVulkanTextureSpecification& specification
 	);
 
@@ -98,6 +103,10 @@ private:
 		const MicroVulkanTextureSpecification& specification
 	) const;
 
+	VkSamplerCreateInfo GetSamplerSpec(
+		const MicroVulkanTextureSpecification& specification
+	) const;
+
 public:
 	operator VkImage ( ) const;
 
@@ -0,0 +1,179 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "__micro_vulkan_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+MicroVulkanTextureCache::MicroVulkanTextureCache( )
+	: m_samplers{ },
+	m_sampler_hashes{ }
+{ }
+
+VkResult MicroVulkanTextureCache::AcquireSampler(
+	const MicroVulkanDevice& device,
+	const VkSamplerCreateInfo& specification,
+	VkSampler& sampler
+) {
+	// Chained structures ( YCbCr conversion, custom border color ) are not
+	// hashed, such samplers are created and destroyed without sharing.
+	if ( specification.pNext != VK_NULL_HANDLE )
+		return vk::CreateImageSampler( device, specification, sampler );
+
+	auto hash  = CreateHash( specification );
+	auto range = m_samplers.equal_range( hash );
+
+	for ( auto entry = range.first; entry != range.second; entry++ ) {
+		auto& cached = entry->second;
+
+		if ( GetIsEqual( cached.Specification, specification ) ) {
+			cached.References += 1;
+
+			sampler = cached.Sampler;
+
+			return VK_SUCCESS;
+		}
+	}
+
+	auto result = vk::CreateImageSampler( device, specification, sampler );
+
+	if ( result == VK_SUCCESS ) {
+		m_samplers.emplace( hash, MicroVulkanCachedSampler{ specification, sampler, 1 } );
+		m_sampler_hashes.emplace( sampler, hash );
+	}
+
+	return result;
+}
+
+void MicroVulkanTextureCache::ReleaseSampler(
+	const MicroVulkanDevice& device,
+	VkSampler& sampler
+) {
+	if ( !vk::IsValid( sampler ) )
+		return;
+
+	auto hash = m_sampler_hashes.find( sampler );
+
+	if ( hash == m_sampler_hashes.end( ) ) {
+		vk::DestroyImageSampler( device, sampler );
+
+		return;
+	}
+
+	auto range = m_samplers.equal_range( hash->second );
+
+	for ( auto entry = range.first; entry != range.second; entry++ ) {
+		auto& cached = entry->second;
+
+		if ( cached.Sampler != sampler )
+			continue;
+
+		if ( --cached.References == 0 ) {
+			vk::DestroyImageSampler( device, cached.Sampler );
+
+			m_samplers.erase( entry );
+			m_sampler_hashes.erase( hash );
+		}
+
+		break;
+	}
+
+	sampler = VK_NULL_HANDLE;
+}
+
+void MicroVulkanTextureCache::Destroy( const MicroVulkanDevice& device ) {
+	for ( auto& [ hash, cached ] : m_samplers )
+		vk::DestroyImageSampler( device, cached.Sampler );
+
+	m_samplers.clear( );
+	m_sampler_hashes.clear( );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint64_t MicroVulkanTextureCache::CreateHash(
+	const VkSamplerCreateInfo& specification
+) const {
+	auto hash = MicroVulkanHash{ };
+
+	hash.Combine( specification.flags );
+	hash.Combine( specification.magFilter );
+	hash.Combine( specification.minFilter );
+	hash.Combine( specification.mipmapMode );
+	hash.Combine( specification.addressModeU );
+	hash.Combine( specification.addressModeV );
+	hash.Combine( specification.addressModeW );
+	hash.Combine( specification.mipLodBias );
+	hash.Combine( specification.anisotropyEnable );
+	hash.Combine( specification.maxAnisotropy );
+	hash.Combine( specification.compareEnable );
+	hash.Combine( specification.compareOp );
+	hash.Combine( specification.minLod );
+	hash.Combine( specification.maxLod );
+	hash.Combine( specification.borderColor );
+	hash.Combine( specification.unnormalizedCoordinates );
+
+	return hash;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t MicroVulkanTextureCache::GetSamplerCount( ) const {
+	return (uint32_t)m_samplers.size( );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool MicroVulkanTextureCache::GetIsEqual(
+	const VkSamplerCreateInfo& left,
+	const VkSamplerCreateInfo& right
+) const {
+	return	left.flags					 == right.flags					  &&
+			left.magFilter				 == right.magFilter				  &&
+			left.minFilter				 == right.minFilter				  &&
+			left.mipmapMode				 == right.mipmapMode			  &&
+			left.addressModeU			 == right.addressModeU			  &&
+			left.addressModeV			 == right.addressModeV			  &&
+			left.addressModeW			 == right.addressModeW			  &&
+			left.mipLodBias				 == right.mipLodBias			  &&
+			left.anisotropyEnable		 == right.anisotropyEnable		  &&
+			left.maxAnisotropy			 == right.maxAnisotropy			  &&
+			left.compareEnable			 == right.compareEnable			  &&
+			left.compareOp				 == right.compareOp				  &&
+			left.minLod					 == right.minLod				  &&
+			left.maxLod					 == right.maxLod				  &&
+			left.borderColor			 == right.borderColor			  &&
+			left.unnormalizedCoordinates == right.unnormalizedCoordinates;
+}
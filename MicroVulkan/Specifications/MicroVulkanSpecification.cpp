@@ -42,7 +42,10 @@ MicroVulkanSpecification::MicroVulkanSpecification( )
     Depths{ },
     RenderPasses{ },
     DimensionsPolicy{ },
-    PipelineCache{ }
+    PipelineCache{ },
+    PipelineCacheInterval{ 60 },
+    PipelineCacheThreshold{ 32 },
+    ShaderObject{ false }
 { }
 
 MicroVulkanSpecification::MicroVulkanSpecification( 
@@ -55,5 +58,8 @@ MicroVulkanSpecification::MicroVulkanSpecification(
     Depths{ other.Depths },
     RenderPasses{ other.RenderPasses },
     DimensionsPolicy{ other.DimensionsPolicy },
-    PipelineCache{ other.PipelineCache }
+    PipelineCache{ other.PipelineCache },
+    PipelineCacheInterval{ other.PipelineCacheInterval },
+    PipelineCacheThreshold{ other.PipelineCacheThreshold },
+    ShaderObject{ other.ShaderObject }
 { }
@@ -43,6 +43,9 @@ micro_struct MicroVulkanSpecification {
 	std::vector<MicroVulkanRenderPass> RenderPasses;
 	MicroVulkanDimensionsPolicy DimensionsPolicy;
 	std::string PipelineCache;
+	uint32_t PipelineCacheInterval;
+	uint32_t PipelineCacheThreshold;
+	bool ShaderObject;
 
 	MicroVulkanSpecification( );
 
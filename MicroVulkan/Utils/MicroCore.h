@@ -43,6 +43,21 @@ micro_struct micro_upoint {
 };
 #endif
 
+/**
+ * micro_target macro
+ * @note : Enable an instruction set for a single function, runtime dispatch
+ *		   must check the CPU before calling it. MSVC needs no attribute.
+ * @param TARGET : Query target string, like "sse4.2,pclmul".
+ **/
+#ifndef micro_target
+#	if defined( __GNUC__ ) || defined( __clang__ )
+#		define micro_target( TARGET ) __attribute__(( target( TARGET ) ))
+#	else
+#		define micro_target( TARGET )
+#	endif
+#endif
+
 #include "vulkan/vulkan.h"
 #include "shaderc/shaderc.hpp"
 #include "spirv-headers/spirv.hpp"
+#include "spirv-tools/optimizer.hpp"
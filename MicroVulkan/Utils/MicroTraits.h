@@ -44,11 +44,14 @@ extern "C" {
 #include <bitset>
 #include <cassert>
 #include <chrono>
+#include <cmath>
 #include <concepts>
 #include <condition_variable>
+#include <deque>
 #include <filesystem>
 #include <format>
 #include <functional>
+#include <future>
 #include <iterator>
 #include <limits>
 #include <map>
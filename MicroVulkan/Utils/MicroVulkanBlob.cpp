@@ -0,0 +1,118 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "__micro_vulkan_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+MicroVulkanBlob::MicroVulkanBlob( )
+	: m_data{ },
+	m_view{ nullptr },
+	m_length{ 0 },
+	m_offset{ 0 },
+	m_is_valid{ true }
+{ }
+
+MicroVulkanBlob::MicroVulkanBlob( const uint8_t* data, const uint64_t length )
+	: m_data{ },
+	m_view{ data },
+	m_length{ length },
+	m_offset{ 0 },
+	m_is_valid{ data != nullptr }
+{ }
+
+void MicroVulkanBlob::Write( const void* data, const size_t length ) {
+	auto* bytes = micro_cast( data, const uint8_t* );
+
+	m_data.insert( m_data.end( ), bytes, bytes + length );
+}
+
+void MicroVulkanBlob::Write( const std::string& text ) {
+	Write( (uint32_t)text.size( ) );
+	Write( text.data( ), text.size( ) );
+}
+
+bool MicroVulkanBlob::Read( void* data, const size_t length ) {
+	// A truncated or corrupted blob poisons every following read, callers
+	// only have to check the last one.
+	m_is_valid = m_is_valid && GetCanRead( length );
+
+	if ( m_is_valid && length > 0 ) {
+		memcpy( data, m_view + m_offset, length );
+
+		m_offset += length;
+	}
+
+	return m_is_valid;
+}
+
+bool MicroVulkanBlob::Read( std::string& text ) {
+	auto length = (uint32_t)0;
+
+	if ( !Read( length ) || !GetCanRead( length ) ) {
+		m_is_valid = false;
+
+		return false;
+	}
+
+	text.assign( micro_cast( m_view + m_offset, const char* ), length );
+
+	m_offset += length;
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool MicroVulkanBlob::GetIsValid( ) const {
+	return m_is_valid;
+}
+
+bool MicroVulkanBlob::GetCanRead( const uint64_t length ) const {
+	return m_view != nullptr && m_offset + length <= m_length;
+}
+
+const std::vector<uint8_t>& MicroVulkanBlob::Get( ) const {
+	return m_data;
+}
+
+std::vector<uint8_t>& MicroVulkanBlob::Get( ) {
+	return m_data;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	OPERATOR ===
+////////////////////////////////////////////////////////////////////////////////////////////
+MicroVulkanBlob::operator bool ( ) const {
+	return GetIsValid( );
+}
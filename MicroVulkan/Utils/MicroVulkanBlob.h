@@ -0,0 +1,104 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "MicroVulkanChecksum.h"
+
+micro_class MicroVulkanBlob final {
+
+private:
+	std::vector<uint8_t> m_data;
+	const uint8_t* m_view;
+	uint64_t m_length;
+	uint64_t m_offset;
+	bool m_is_valid;
+
+public:
+	MicroVulkanBlob( );
+
+	MicroVulkanBlob( const uint8_t* data, const uint64_t length );
+
+	~MicroVulkanBlob( ) = default;
+
+	void Write( const void* data, const size_t length );
+
+	void Write( const std::string& text );
+
+	template<typename Type>
+		requires std::is_trivially_copyable_v<Type>
+	void Write( const Type& value ) {
+		Write( micro_ptr( value ), sizeof( Type ) );
+	};
+
+	template<typename Type>
+		requires std::is_trivially_copyable_v<Type>
+	void Write( const std::vector<Type>& values ) {
+		Write( (uint32_t)values.size( ) );
+		Write( values.data( ), values.size( ) * sizeof( Type ) );
+	};
+
+	bool Read( void* data, const size_t length );
+
+	bool Read( std::string& text );
+
+	template<typename Type>
+		requires std::is_trivially_copyable_v<Type>
+	bool Read( Type& value ) {
+		return Read( micro_ptr( value ), sizeof( Type ) );
+	};
+
+	template<typename Type>
+		requires std::is_trivially_copyable_v<Type>
+	bool Read( std::vector<Type>& values ) {
+		auto count = (uint32_t)0;
+
+		if ( !Read( count ) || !GetCanRead( (uint64_t)count * sizeof( Type ) ) )
+			return false;
+
+		values.resize( count );
+
+		return Read( values.data( ), values.size( ) * sizeof( Type ) );
+	};
+
+public:
+	bool GetIsValid( ) const;
+
+	bool GetCanRead( const uint64_t length ) const;
+
+	const std::vector<uint8_t>& Get( ) const;
+
+	std::vector<uint8_t>& Get( );
+
+public:
+	operator bool ( ) const;
+
+};
@@ -0,0 +1,323 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "__micro_vulkan_pch.h"
+
+#if defined( __x86_64__ ) || defined( _M_X64 )
+#	define MICRO_CHECKSUM_X64
+#	include <immintrin.h>
+#	ifdef _MSC_VER
+#		include <intrin.h>
+#	endif
+#endif
+
+#ifdef MICRO_VULKAN_USE_XXHASH
+#	include <xxhash.h>
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	INTERNAL ===
+////////////////////////////////////////////////////////////////////////////////////////////
+typedef std::array<std::array<uint32_t, 256>, 8> MicroVulkanCRCTables;
+
+constexpr MicroVulkanCRCTables ivk_CreateCRCTables( const uint32_t polynomial ) {
+	auto tables = MicroVulkanCRCTables{ };
+
+	for ( auto byte = 0u; byte < 256; byte++ ) {
+		auto crc = byte;
+
+		for ( auto bit = 0u; bit < 8; bit++ )
+			crc = ( crc >> 1 ) ^ ( ( crc & 1 ) ? polynomial : 0 );
+
+		tables[ 0 ][ byte ] = crc;
+	}
+
+	for ( auto slice = 1u; slice < 8; slice++ ) {
+		for ( auto byte = 0u; byte < 256; byte++ ) {
+			auto previous = tables[ slice - 1 ][ byte ];
+
+			tables[ slice ][ byte ] = ( previous >> 8 ) ^ tables[ 0 ][ previous & 0xFF ];
+		}
+	}
+
+	return tables;
+}
+
+constexpr MicroVulkanCRCTables ivk_CRC32Tables  = ivk_CreateCRCTables( 0xEDB88320 );
+constexpr MicroVulkanCRCTables ivk_CRC32CTables = ivk_CreateCRCTables( 0x82F63B78 );
+
+uint32_t ivk_SliceBy8(
+	const MicroVulkanCRCTables& tables,
+	const uint8_t* data,
+	uint64_t length,
+	uint32_t state
+) {
+	// Eight table lookups per 8 bytes instead of one lookup per byte, each
+	// table advances the CRC by a different byte distance.
+	while ( length >= 8 ) {
+		auto low  = (uint32_t)0;
+		auto high = (uint32_t)0;
+
+		memcpy( micro_ptr( low ), data, sizeof( uint32_t ) );
+		memcpy( micro_ptr( high ), data + 4, sizeof( uint32_t ) );
+
+		low ^= state;
+
+		state = tables[ 7 ][ low & 0xFF ] ^ tables[ 6 ][ ( low >> 8 ) & 0xFF ] ^
+				tables[ 5 ][ ( low >> 16 ) & 0xFF ] ^ tables[ 4 ][ low >> 24 ] ^
+				tables[ 3 ][ high & 0xFF ] ^ tables[ 2 ][ ( high >> 8 ) & 0xFF ] ^
+				tables[ 1 ][ ( high >> 16 ) & 0xFF ] ^ tables[ 0 ][ high >> 24 ];
+
+		data   += 8;
+		length -= 8;
+	}
+
+	while ( length-- > 0 )
+		state = tables[ 0 ][ ( state ^ *data++ ) & 0xFF ] ^ ( state >> 8 );
+
+	return state;
+}
+
+uint32_t ivk_CRC32Scalar( const uint8_t* data, const uint64_t length, const uint32_t state ) {
+	return ivk_SliceBy8( ivk_CRC32Tables, data, length, state );
+}
+
+uint32_t ivk_CRC32CScalar( const uint8_t* data, const uint64_t length, const uint32_t state ) {
+	return ivk_SliceBy8( ivk_CRC32CTables, data, length, state );
+}
+
+#ifdef MICRO_CHECKSUM_X64
+micro_target( "sse4.1,pclmul" )
+uint32_t ivk_CRC32PCLMUL( const uint8_t* data, const uint64_t length, const uint32_t state ) {
+	// Fold 64 bytes per iteration with carry-less multiplies by x^n mod P
+	// constants, then reduce 128 bits to 32 with a Barrett reduction.
+	// Constants from "Fast CRC Computation for Generic Polynomials Using
+	// PCLMULQDQ Instruction", Intel 2009, for the reflected IEEE polynomial.
+	alignas( 16 ) static const uint64_t k1k2[ 2 ] = { 0x0154442bd4, 0x01c6e41596 };
+	alignas( 16 ) static const uint64_t k3k4[ 2 ] = { 0x01751997d0, 0x00ccaa009e };
+	alignas( 16 ) static const uint64_t k5k0[ 2 ] = { 0x0163cd6124, 0x0000000000 };
+	alignas( 16 ) static const uint64_t poly[ 2 ] = { 0x01db710641, 0x01f7011641 };
+
+	if ( length < 64 )
+		return ivk_CRC32Scalar( data, length, state );
+
+	auto folded = length & ~(uint64_t)15;
+	auto* input = data;
+	auto count	= folded - 64;
+
+	auto x1 = _mm_loadu_si128( micro_cast( input + 0x00, const __m128i* ) );
+	auto x2 = _mm_loadu_si128( micro_cast( input + 0x10, const __m128i* ) );
+	auto x3 = _mm_loadu_si128( micro_cast( input + 0x20, const __m128i* ) );
+	auto x4 = _mm_loadu_si128( micro_cast( input + 0x30, const __m128i* ) );
+	auto x0 = _mm_load_si128( micro_cast( k1k2, const __m128i* ) );
+
+	x1	   = _mm_xor_si128( x1, _mm_cvtsi32_si128( (int)state ) );
+	input += 64;
+
+	while ( count >= 64 ) {
+		auto x5 = _mm_clmulepi64_si128( x1, x0, 0x00 );
+		auto x6 = _mm_clmulepi64_si128( x2, x0, 0x00 );
+		auto x7 = _mm_clmulepi64_si128( x3, x0, 0x00 );
+		auto x8 = _mm_clmulepi64_si128( x4, x0, 0x00 );
+
+		x1 = _mm_clmulepi64_si128( x1, x0, 0x11 );
+		x2 = _mm_clmulepi64_si128( x2, x0, 0x11 );
+		x3 = _mm_clmulepi64_si128( x3, x0, 0x11 );
+		x4 = _mm_clmulepi64_si128( x4, x0, 0x11 );
+
+		x1 = _mm_xor_si128( _mm_xor_si128( x1, x5 ), _mm_loadu_si128( micro_cast( input + 0x00, const __m128i* ) ) );
+		x2 = _mm_xor_si128( _mm_xor_si128( x2, x6 ), _mm_loadu_si128( micro_cast( input + 0x10, const __m128i* ) ) );
+		x3 = _mm_xor_si128( _mm_xor_si128( x3, x7 ), _mm_loadu_si128( micro_cast( input + 0x20, const __m128i* ) ) );
+		x4 = _mm_xor_si128( _mm_xor_si128( x4, x8 ), _mm_loadu_si128( micro_cast( input + 0x30, const __m128i* ) ) );
+
+		input += 64;
+		count -= 64;
+	}
+
+	x0 = _mm_load_si128( micro_cast( k3k4, const __m128i* ) );
+
+	auto x5 = _mm_clmulepi64_si128( x1, x0, 0x00 );
+
+	x1 = _mm_clmulepi64_si128( x1, x0, 0x11 );
+	x1 = _mm_xor_si128( _mm_xor_si128( x1, x2 ), x5 );
+	x5 = _mm_clmulepi64_si128( x1, x0, 0x00 );
+	x1 = _mm_clmulepi64_si128( x1, x0, 0x11 );
+	x1 = _mm_xor_si128( _mm_xor_si128( x1, x3 ), x5 );
+	x5 = _mm_clmulepi64_si128( x1, x0, 0x00 );
+	x1 = _mm_clmulepi64_si128( x1, x0, 0x11 );
+	x1 = _mm_xor_si128( _mm_xor_si128( x1, x4 ), x5 );
+
+	while ( count >= 16 ) {
+		x5 = _mm_clmulepi64_si128( x1, x0, 0x00 );
+		x1 = _mm_clmulepi64_si128( x1, x0, 0x11 );
+		x1 = _mm_xor_si128( _mm_xor_si128( x1, _mm_loadu_si128( micro_cast( input, const __m128i* ) ) ), x5 );
+
+		input += 16;
+		count -= 16;
+	}
+
+	auto mask = _mm_setr_epi32( ~0, 0, ~0, 0 );
+
+	x2 = _mm_clmulepi64_si128( x1, x0, 0x10 );
+	x1 = _mm_xor_si128( _mm_srli_si128( x1, 8 ), x2 );
+	x0 = _mm_loadl_epi64( micro_cast( k5k0, const __m128i* ) );
+	x2 = _mm_srli_si128( x1, 4 );
+	x1 = _mm_and_si128( x1, mask );
+	x1 = _mm_xor_si128( _mm_clmulepi64_si128( x1, x0, 0x00 ), x2 );
+
+	x0 = _mm_load_si128( micro_cast( poly, const __m128i* ) );
+	x2 = _mm_and_si128( x1, mask );
+	x2 = _mm_clmulepi64_si128( x2, x0, 0x10 );
+	x2 = _mm_and_si128( x2, mask );
+	x2 = _mm_clmulepi64_si128( x2, x0, 0x00 );
+	x1 = _mm_xor_si128( x1, x2 );
+
+	auto crc = (uint32_t)_mm_extract_epi32( x1, 1 );
+
+	return ivk_CRC32Scalar( data + folded, length - folded, crc );
+}
+
+micro_target( "sse4.2" )
+uint32_t ivk_CRC32CSSE42( const uint8_t* data, const uint64_t length, const uint32_t state ) {
+	auto crc   = (uint64_t)state;
+	auto count = length;
+
+	while ( count >= 8 ) {
+		auto value = (uint64_t)0;
+
+		memcpy( micro_ptr( value ), data, sizeof( uint64_t ) );
+
+		crc    = _mm_crc32_u64( crc, value );
+		data  += 8;
+		count -= 8;
+	}
+
+	auto crc32 = (uint32_t)crc;
+
+	while ( count-- > 0 )
+		crc32 = _mm_crc32_u8( crc32, *data++ );
+
+	return crc32;
+}
+#endif
+
+void ivk_GetChecksumKernels(
+	MicroVulkanChecksumKernel& crc32,
+	MicroVulkanChecksumKernel& crc32c,
+	micro_string& crc32_name,
+	micro_string& crc32c_name
+) {
+	crc32		= ivk_CRC32Scalar;
+	crc32c		= ivk_CRC32CScalar;
+	crc32_name	= "Slice-by-8";
+	crc32c_name = "Slice-by-8";
+
+#	ifdef MICRO_CHECKSUM_X64
+#		ifdef _MSC_VER
+	int info[ 4 ];
+
+	__cpuid( info, 1 );
+
+	auto has_pclmul = ( ( info[ 2 ] >> 1 ) & 1 ) != 0;
+	auto has_sse41	= ( ( info[ 2 ] >> 19 ) & 1 ) != 0;
+	auto has_sse42	= ( ( info[ 2 ] >> 20 ) & 1 ) != 0;
+#		else
+	__builtin_cpu_init( );
+
+	auto has_pclmul = __builtin_cpu_supports( "pclmul" ) != 0;
+	auto has_sse41	= __builtin_cpu_supports( "sse4.1" ) != 0;
+	auto has_sse42	= __builtin_cpu_supports( "sse4.2" ) != 0;
+#		endif
+
+	if ( has_pclmul && has_sse41 ) {
+		crc32	   = ivk_CRC32PCLMUL;
+		crc32_name = "PCLMULQDQ";
+	}
+
+	if ( has_sse42 ) {
+		crc32c		= ivk_CRC32CSSE42;
+		crc32c_name = "SSE4.2";
+	}
+#	endif
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+MicroVulkanChecksum::MicroVulkanChecksum( )
+	: m_crc32{ nullptr },
+	m_crc32c{ nullptr },
+	m_crc32_name{ "" },
+	m_crc32c_name{ "" }
+{ 
+	ivk_GetChecksumKernels( m_crc32, m_crc32c, m_crc32_name, m_crc32c_name );
+}
+
+uint32_t MicroVulkanChecksum::CRC32( const uint8_t* data, const uint64_t length ) const {
+	return CRC32( data, length, 0 );
+}
+
+uint32_t MicroVulkanChecksum::CRC32(
+	const uint8_t* data,
+	const uint64_t length,
+	const uint32_t crc
+) const {
+	return ~m_crc32( data, length, ~crc );
+}
+
+uint32_t MicroVulkanChecksum::CRC32C( const uint8_t* data, const uint64_t length ) const {
+	return CRC32C( data, length, 0 );
+}
+
+uint32_t MicroVulkanChecksum::CRC32C(
+	const uint8_t* data,
+	const uint64_t length,
+	const uint32_t crc
+) const {
+	return ~m_crc32c( data, length, ~crc );
+}
+
+#ifdef MICRO_VULKAN_USE_XXHASH
+uint64_t MicroVulkanChecksum::XXH3( const uint8_t* data, const uint64_t length ) const {
+	return (uint64_t)XXH3_64bits( data, (size_t)length );
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+micro_string MicroVulkanChecksum::GetCRC32Kernel( ) const {
+	return m_crc32_name;
+}
+
+micro_string MicroVulkanChecksum::GetCRC32CKernel( ) const {
+	return m_crc32c_name;
+}
@@ -0,0 +1,80 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "MicroVulkanHash.h"
+
+typedef uint32_t ( *MicroVulkanChecksumKernel )( 
+	const uint8_t* data, 
+	const uint64_t length, 
+	const uint32_t state 
+);
+
+micro_class MicroVulkanChecksum final {
+
+private:
+	MicroVulkanChecksumKernel m_crc32;
+	MicroVulkanChecksumKernel m_crc32c;
+	micro_string m_crc32_name;
+	micro_string m_crc32c_name;
+
+public:
+	MicroVulkanChecksum( );
+
+	~MicroVulkanChecksum( ) = default;
+
+	uint32_t CRC32( const uint8_t* data, const uint64_t length ) const;
+
+	uint32_t CRC32( 
+		const uint8_t* data, 
+		const uint64_t length, 
+		const uint32_t crc 
+	) const;
+
+	uint32_t CRC32C( const uint8_t* data, const uint64_t length ) const;
+
+	uint32_t CRC32C( 
+		const uint8_t* data, 
+		const uint64_t length, 
+		const uint32_t crc 
+	) const;
+
+#	ifdef MICRO_VULKAN_USE_XXHASH
+	uint64_t XXH3( const uint8_t* data, const uint64_t length ) const;
+#	endif
+
+public:
+	micro_string GetCRC32Kernel( ) const;
+
+	micro_string GetCRC32CKernel( ) const;
+
+};
@@ -0,0 +1,72 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "MicroVulkanWorkerPool.h"
+
+micro_class MicroVulkanHash final {
+
+	constexpr static uint64_t HASH_SEED  = 0xcbf29ce484222325ull;
+	constexpr static uint64_t HASH_PRIME = 0x100000001b3ull;
+
+private:
+	uint64_t m_value;
+
+public:
+	MicroVulkanHash( );
+
+	~MicroVulkanHash( ) = default;
+
+	void Combine( const void* data, const size_t length );
+
+	void Combine( const std::string& text );
+
+	template<typename Type>
+		requires std::is_trivially_copyable_v<Type>
+	void Combine( const Type& value ) {
+		Combine( micro_ptr( value ), sizeof( Type ) );
+	}
+
+	template<typename Type>
+		requires std::is_trivially_copyable_v<Type>
+	void Combine( const std::vector<Type>& values ) {
+		Combine( (uint64_t)values.size( ) );
+		Combine( values.data( ), values.size( ) * sizeof( Type ) );
+	}
+
+public:
+	uint64_t Get( ) const;
+
+public:
+	operator uint64_t ( ) const;
+
+};
@@ -0,0 +1,154 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "__micro_vulkan_pch.h"
+
+#ifdef _WIN32
+#	include <Windows.h>
+#else
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+MicroVulkanMappedFile::MicroVulkanMappedFile( )
+	: m_file{ NULL },
+	m_mapping{ NULL },
+	m_data{ NULL },
+	m_size{ 0 }
+{ }
+
+MicroVulkanMappedFile::~MicroVulkanMappedFile( ) {
+	Close( );
+}
+
+bool MicroVulkanMappedFile::Open( const std::string& path ) {
+	Close( );
+
+#	ifdef _WIN32
+	auto file = CreateFileA( path.c_str( ), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+
+	if ( file != INVALID_HANDLE_VALUE ) {
+		auto size = LARGE_INTEGER{ };
+
+		m_file = micro_cast( file, void* );
+
+		if ( GetFileSizeEx( file, micro_ptr( size ) ) && size.QuadPart > 0 ) {
+			m_size	  = (uint64_t)size.QuadPart;
+			m_mapping = CreateFileMappingA( file, NULL, PAGE_READONLY, 0, 0, NULL );
+
+			if ( m_mapping != NULL )
+				m_data = micro_cast( MapViewOfFile( m_mapping, FILE_MAP_READ, 0, 0, 0 ), uint8_t* );
+		}
+	}
+#	else
+	auto file = open( path.c_str( ), O_RDONLY );
+
+	if ( file != -1 ) {
+		struct stat status = { };
+
+		if ( fstat( file, micro_ptr( status ) ) == 0 && status.st_size > 0 ) {
+			auto* mapping = mmap( NULL, (size_t)status.st_size, PROT_READ, MAP_PRIVATE, file, 0 );
+
+			if ( mapping != MAP_FAILED ) {
+				m_data = micro_cast( mapping, uint8_t* );
+				m_size = (uint64_t)status.st_size;
+
+				madvise( mapping, (size_t)m_size, MADV_SEQUENTIAL );
+			}
+		}
+
+		// The mapping holds its own reference to the file.
+		close( file );
+	}
+#	endif
+
+	if ( !GetIsValid( ) )
+		Close( );
+
+	return GetIsValid( );
+}
+
+void MicroVulkanMappedFile::Close( ) {
+#	ifdef _WIN32
+	if ( m_data != NULL )
+		UnmapViewOfFile( m_data );
+
+	if ( m_mapping != NULL )
+		CloseHandle( micro_cast( m_mapping, HANDLE ) );
+
+	if ( m_file != NULL )
+		CloseHandle( micro_cast( m_file, HANDLE ) );
+#	else
+	if ( m_data != NULL )
+		munmap( m_data, (size_t)m_size );
+#	endif
+
+	m_file	  = NULL;
+	m_mapping = NULL;
+	m_data	  = NULL;
+	m_size	  = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool MicroVulkanMappedFile::GetIsValid( ) const {
+	return m_data != NULL && m_size > 0;
+}
+
+const uint8_t* MicroVulkanMappedFile::GetData( ) const {
+	return m_data;
+}
+
+const uint8_t* MicroVulkanMappedFile::GetData( const uint64_t offset, const uint64_t length ) const {
+	auto* data = micro_cast( NULL, const uint8_t* );
+
+	if ( GetIsValid( ) && offset <= m_size && length <= m_size - offset )
+		data = m_data + offset;
+
+	return data;
+}
+
+uint64_t MicroVulkanMappedFile::GetSize( ) const {
+	return m_size;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	OPERATOR ===
+////////////////////////////////////////////////////////////////////////////////////////////
+MicroVulkanMappedFile::operator bool ( ) const {
+	return GetIsValid( );
+}
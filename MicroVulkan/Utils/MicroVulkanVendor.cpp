@@ -40,6 +40,32 @@
 VkAllocationCallbacks* ivk_Allocator = VK_NULL_HANDLE;
 PFN_vkCreateDebugUtilsMessengerEXT ivk_CreateDebugMessenger = VK_NULL_HANDLE;
 PFN_vkDestroyDebugUtilsMessengerEXT ivk_DestroyDebugMessenger = VK_NULL_HANDLE;
+PFN_vkGetShaderModuleCreateInfoIdentifierEXT ivk_GetShaderModuleIdentifier = VK_NULL_HANDLE;
+PFN_vkCmdSetCullModeEXT ivk_CmdSetCullMode = VK_NULL_HANDLE;
+PFN_vkCmdSetFrontFaceEXT ivk_CmdSetFrontFace = VK_NULL_HANDLE;
+PFN_vkCmdSetDepthTestEnableEXT ivk_CmdSetDepthTestEnable = VK_NULL_HANDLE;
+PFN_vkCmdSetDepthWriteEnableEXT ivk_CmdSetDepthWriteEnable = VK_NULL_HANDLE;
+PFN_vkCmdSetDepthCompareOpEXT ivk_CmdSetDepthCompareOp = VK_NULL_HANDLE;
+PFN_vkCmdSetPolygonModeEXT ivk_CmdSetPolygonMode = VK_NULL_HANDLE;
+PFN_vkCmdSetColorBlendEnableEXT ivk_CmdSetColorBlendEnable = VK_NULL_HANDLE;
+PFN_vkCmdSetColorBlendEquationEXT ivk_CmdSetColorBlendEquation = VK_NULL_HANDLE;
+PFN_vkCmdSetColorWriteMaskEXT ivk_CmdSetColorWriteMask = VK_NULL_HANDLE;
+PFN_vkCmdSetVertexInputEXT ivk_CmdSetVertexInput = VK_NULL_HANDLE;
+PFN_vkCmdSetPrimitiveTopologyEXT ivk_CmdSetPrimitiveTopology = VK_NULL_HANDLE;
+PFN_vkCmdSetPrimitiveRestartEnableEXT ivk_CmdSetPrimitiveRestartEnable = VK_NULL_HANDLE;
+PFN_vkCmdSetRasterizerDiscardEnableEXT ivk_CmdSetRasterizerDiscardEnable = VK_NULL_HANDLE;
+PFN_vkCmdSetDepthBiasEnableEXT ivk_CmdSetDepthBiasEnable = VK_NULL_HANDLE;
+PFN_vkCmdSetRasterizationSamplesEXT ivk_CmdSetRasterizationSamples = VK_NULL_HANDLE;
+PFN_vkCmdSetSampleMaskEXT ivk_CmdSetSampleMask = VK_NULL_HANDLE;
+PFN_vkCmdSetAlphaToCoverageEnableEXT ivk_CmdSetAlphaToCoverageEnable = VK_NULL_HANDLE;
+PFN_vkCmdSetStencilTestEnableEXT ivk_CmdSetStencilTestEnable = VK_NULL_HANDLE;
+PFN_vkCmdSetViewportWithCountEXT ivk_CmdSetViewportWithCount = VK_NULL_HANDLE;
+PFN_vkCmdSetScissorWithCountEXT ivk_CmdSetScissorWithCount = VK_NULL_HANDLE;
+PFN_vkCreateShadersEXT ivk_CreateShaders = VK_NULL_HANDLE;
+PFN_vkDestroyShaderEXT ivk_DestroyShader = VK_NULL_HANDLE;
+PFN_vkCmdBindShadersEXT ivk_CmdBindShaders = VK_NULL_HANDLE;
+PFN_vkCmdBeginRenderingKHR ivk_CmdBeginRendering = VK_NULL_HANDLE;
+PFN_vkCmdEndRenderingKHR ivk_CmdEndRendering = VK_NULL_HANDLE;
 
 ////////////////////////////////////////////////////////////////////////////////////////////
 //		===	PUBLIC ===
@@ -479,6 +505,25 @@ namespace vk {
 		layout = VK_NULL_HANDLE;
 	}
 
+	VkResult CreateDescriptorSetLayout(
+		const VkDevice& device,
+		const VkDescriptorSetLayoutCreateInfo& specification,
+		VkDescriptorSetLayout& layout
+	) {
+		micro_assert( IsValid( device ), "Vulkan Device must be valid to use this function" );
+
+		return vkCreateDescriptorSetLayout( device, micro_ptr( specification ), ivk_Allocator, micro_ptr( layout ) );
+	}
+
+	void DestroyDescriptorSetLayout( const VkDevice& device, VkDescriptorSetLayout& layout ) {
+		if ( !IsValid( device ) || !IsValid( layout ) )
+			return;
+
+		vkDestroyDescriptorSetLayout( device, layout, ivk_Allocator );
+
+		layout = VK_NULL_HANDLE;
+	}
+
 	VkResult CreateDescriptorPool(
 		const VkDevice& device,
 		const VkDescriptorPoolCreateInfo& specification,
@@ -540,6 +585,15 @@ namespace vk {
 		vkFreeDescriptorSets( device, descriptor_pool, descriptor_count, list_data );
 	}
 
+	VkResult ResetDescriptorPool(
+		const VkDevice& device,
+		const VkDescriptorPool& descriptor_pool
+	) {
+		micro_assert( IsValid( device ), "Vulkan Device must be valid to use this function" );
+
+		return vkResetDescriptorPool( device, descriptor_pool, VK_UNUSED_FLAG );
+	}
+
 	VkResult CreateShader(
 		const VkDevice& device,
 		const VkShaderModuleCreateInfo& specification,
@@ -609,6 +663,26 @@ namespace vk {
 		query_pool = VK_NULL_HANDLE;
 	}
 
+	VkResult CreateShaderObject(
+		const VkDevice& device,
+		const VkShaderCreateInfoEXT& specification,
+		VkShaderEXT& shader
+	) {
+		micro_assert( IsValid( device ), "Vulkan Device must be valid to use this function" );
+		micro_assert( IsValid( ivk_CreateShaders ), "Shader objects must be loaded to use this function" );
+
+		return ivk_CreateShaders( device, 1, micro_ptr( specification ), ivk_Allocator, micro_ptr( shader ) );
+	}
+
+	void DestroyShaderObject( const VkDevice& device, VkShaderEXT& shader ) {
+		if ( !IsValid( device ) || !IsValid( shader ) )
+			return;
+
+		ivk_DestroyShader( device, shader, ivk_Allocator );
+
+		shader = VK_NULL_HANDLE;
+	}
+
 	VkResult WaitForFence(
 		const VkDevice& device,
 		const VkFence& fence,
@@ -726,6 +800,9 @@ namespace vk {
 		micro_assert( IsValid( commands ), "You can't execute command on an invalid command buffer" );
 
 		vkCmdSetViewport( commands, 0, 1, micro_ptr( viewport ) );
+
+		if ( IsValid( ivk_CmdSetViewportWithCount ) )
+			ivk_CmdSetViewportWithCount( commands, 1, micro_ptr( viewport ) );
 	}
 
 	void CmdSetViewport(
@@ -743,6 +820,9 @@ namespace vk {
 		const auto* viewport_data = viewports.data( );
 		
 		vkCmdSetViewport( commands, start_id, viewport_count, viewport_data );
+
+		if ( start_id == 0 && IsValid( ivk_CmdSetViewportWithCount ) )
+			ivk_CmdSetViewportWithCount( commands, viewport_count, viewport_data );
 	}
 
 	void CmdSetScissor(
@@ -752,6 +832,9 @@ namespace vk {
 		micro_assert( IsValid( commands ), "You can't execute command on an invalid command buffer" );
 
 		vkCmdSetScissor( commands, 0, 1, micro_ptr( scissor ) );
+
+		if ( IsValid( ivk_CmdSetScissorWithCount ) )
+			ivk_CmdSetScissorWithCount( commands, 1, micro_ptr( scissor ) );
 	}
 
 	void CmdSetScissor(
@@ -763,12 +846,169 @@ namespace vk {
 		
 		const auto scissor_count = (uint32_t)scissors.size( );
 
-		if ( scissor_count > 0 )
+		if ( scissor_count == 0 )
 			return;
 
 		const auto* scissor_data = scissors.data( );
 
 		vkCmdSetScissor( commands, start_id, scissor_count, scissor_data );
+
+		if ( start_id == 0 && IsValid( ivk_CmdSetScissorWithCount ) )
+			ivk_CmdSetScissorWithCount( commands, scissor_count, scissor_data );
+	}
+
+	void CmdBindPipeline(
+		const VkCommandBuffer& commands,
+		const VkPipelineBindPoint bind_point,
+		const VkPipeline& pipeline
+	) {
+		micro_assert( IsValid( commands ), "You can't execute command on an invalid command buffer" );
+
+		vkCmdBindPipeline( commands, bind_point, pipeline );
+	}
+
+	void CmdPushConstants(
+		const VkCommandBuffer& commands,
+		const VkPipelineLayout& layout,
+		const VkShaderStageFlags stages,
+		const uint32_t offset,
+		const uint32_t length,
+		const void* data
+	) {
+		micro_assert( IsValid( commands ), "You can't execute command on an invalid command buffer" );
+
+		if ( length > 0 && data != nullptr )
+			vkCmdPushConstants( commands, layout, stages, offset, length, data );
+	}
+
+	void LoadDynamicState( const VkDevice& device ) {
+		micro_assert( IsValid( device ), "Vulkan Device must be valid to use this function" );
+
+		ivk_CmdSetCullMode			 = vk::GetDeviceProcAddr<PFN_vkCmdSetCullModeEXT>( device, "vkCmdSetCullModeEXT" );
+		ivk_CmdSetFrontFace			 = vk::GetDeviceProcAddr<PFN_vkCmdSetFrontFaceEXT>( device, "vkCmdSetFrontFaceEXT" );
+		ivk_CmdSetDepthTestEnable	 = vk::GetDeviceProcAddr<PFN_vkCmdSetDepthTestEnableEXT>( device, "vkCmdSetDepthTestEnableEXT" );
+		ivk_CmdSetDepthWriteEnable	 = vk::GetDeviceProcAddr<PFN_vkCmdSetDepthWriteEnableEXT>( device, "vkCmdSetDepthWriteEnableEXT" );
+		ivk_CmdSetDepthCompareOp	 = vk::GetDeviceProcAddr<PFN_vkCmdSetDepthCompareOpEXT>( device, "vkCmdSetDepthCompareOpEXT" );
+		ivk_CmdSetPolygonMode		 = vk::GetDeviceProcAddr<PFN_vkCmdSetPolygonModeEXT>( device, "vkCmdSetPolygonModeEXT" );
+		ivk_CmdSetColorBlendEnable	 = vk::GetDeviceProcAddr<PFN_vkCmdSetColorBlendEnableEXT>( device, "vkCmdSetColorBlendEnableEXT" );
+		ivk_CmdSetColorBlendEquation = vk::GetDeviceProcAddr<PFN_vkCmdSetColorBlendEquationEXT>( device, "vkCmdSetColorBlendEquationEXT" );
+		ivk_CmdSetColorWriteMask	 = vk::GetDeviceProcAddr<PFN_vkCmdSetColorWriteMaskEXT>( device, "vkCmdSetColorWriteMaskEXT" );
+
+		// Shader objects expose every state setter, on other devices those
+		// entry points resolve to null and are never listed as dynamic.
+		ivk_CmdSetVertexInput			  = vk::GetDeviceProcAddr<PFN_vkCmdSetVertexInputEXT>( device, "vkCmdSetVertexInputEXT" );
+		ivk_CmdSetPrimitiveTopology		  = vk::GetDeviceProcAddr<PFN_vkCmdSetPrimitiveTopologyEXT>( device, "vkCmdSetPrimitiveTopologyEXT" );
+		ivk_CmdSetPrimitiveRestartEnable  = vk::GetDeviceProcAddr<PFN_vkCmdSetPrimitiveRestartEnableEXT>( device, "vkCmdSetPrimitiveRestartEnableEXT" );
+		ivk_CmdSetRasterizerDiscardEnable = vk::GetDeviceProcAddr<PFN_vkCmdSetRasterizerDiscardEnableEXT>( device, "vkCmdSetRasterizerDiscardEnableEXT" );
+		ivk_CmdSetDepthBiasEnable		  = vk::GetDeviceProcAddr<PFN_vkCmdSetDepthBiasEnableEXT>( device, "vkCmdSetDepthBiasEnableEXT" );
+		ivk_CmdSetRasterizationSamples	  = vk::GetDeviceProcAddr<PFN_vkCmdSetRasterizationSamplesEXT>( device, "vkCmdSetRasterizationSamplesEXT" );
+		ivk_CmdSetSampleMask			  = vk::GetDeviceProcAddr<PFN_vkCmdSetSampleMaskEXT>( device, "vkCmdSetSampleMaskEXT" );
+		ivk_CmdSetAlphaToCoverageEnable	  = vk::GetDeviceProcAddr<PFN_vkCmdSetAlphaToCoverageEnableEXT>( device, "vkCmdSetAlphaToCoverageEnableEXT" );
+		ivk_CmdSetStencilTestEnable		  = vk::GetDeviceProcAddr<PFN_vkCmdSetStencilTestEnableEXT>( device, "vkCmdSetStencilTestEnableEXT" );
+	}
+
+	void LoadShaderObject( const VkDevice& device ) {
+		micro_assert( IsValid( device ), "Vulkan Device must be valid to use this function" );
+
+		ivk_CreateShaders			= vk::GetDeviceProcAddr<PFN_vkCreateShadersEXT>( device, "vkCreateShadersEXT" );
+		ivk_DestroyShader			= vk::GetDeviceProcAddr<PFN_vkDestroyShaderEXT>( device, "vkDestroyShaderEXT" );
+		ivk_CmdBindShaders			= vk::GetDeviceProcAddr<PFN_vkCmdBindShadersEXT>( device, "vkCmdBindShadersEXT" );
+		ivk_CmdSetViewportWithCount = vk::GetDeviceProcAddr<PFN_vkCmdSetViewportWithCountEXT>( device, "vkCmdSetViewportWithCountEXT" );
+		ivk_CmdSetScissorWithCount	= vk::GetDeviceProcAddr<PFN_vkCmdSetScissorWithCountEXT>( device, "vkCmdSetScissorWithCountEXT" );
+		ivk_CmdBeginRendering		= vk::GetDeviceProcAddr<PFN_vkCmdBeginRenderingKHR>( device, "vkCmdBeginRendering" );
+		ivk_CmdEndRendering			= vk::GetDeviceProcAddr<PFN_vkCmdEndRenderingKHR>( device, "vkCmdEndRendering" );
+
+		// Dynamic rendering is only exposed under its extension name before 1.3.
+		if ( !IsValid( ivk_CmdBeginRendering ) ) {
+			ivk_CmdBeginRendering = vk::GetDeviceProcAddr<PFN_vkCmdBeginRenderingKHR>( device, "vkCmdBeginRenderingKHR" );
+			ivk_CmdEndRendering	  = vk::GetDeviceProcAddr<PFN_vkCmdEndRenderingKHR>( device, "vkCmdEndRenderingKHR" );
+		}
+	}
+
+	void CmdSetDynamicState(
+		const VkCommandBuffer& commands,
+		const std::vector<VkDynamicState>& dynamic_states,
+		const DynamicStateSpecification& specification
+	) {
+		micro_assert( IsValid( commands ), "You can't execute command on an invalid command buffer" );
+
+		auto blend_count	 = (uint32_t)specification.BlendEnables.size( );
+		auto binding_count	 = (uint32_t)specification.VertexBindings.size( );
+		auto attribute_count = (uint32_t)specification.VertexAttributes.size( );
+		auto sample_mask	 = std::array<VkSampleMask, 2>{ UINT32_MAX, UINT32_MAX };
+
+		for ( const auto dynamic_state : dynamic_states ) {
+			switch ( dynamic_state ) {
+				case VK_DYNAMIC_STATE_CULL_MODE						: ivk_CmdSetCullMode( commands, specification.CullMode ); break;
+				case VK_DYNAMIC_STATE_FRONT_FACE					: ivk_CmdSetFrontFace( commands, specification.FrontFace ); break;
+				case VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE				: ivk_CmdSetDepthTestEnable( commands, specification.DepthTest ); break;
+				case VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE			: ivk_CmdSetDepthWriteEnable( commands, specification.DepthWrite ); break;
+				case VK_DYNAMIC_STATE_DEPTH_COMPARE_OP				: ivk_CmdSetDepthCompareOp( commands, specification.DepthCompare ); break;
+				case VK_DYNAMIC_STATE_POLYGON_MODE_EXT				: ivk_CmdSetPolygonMode( commands, specification.PolygonMode ); break;
+
+				case VK_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY			: ivk_CmdSetPrimitiveTopology( commands, specification.Topology ); break;
+				case VK_DYNAMIC_STATE_PRIMITIVE_RESTART_ENABLE		: ivk_CmdSetPrimitiveRestartEnable( commands, specification.PrimitiveRestart ); break;
+				case VK_DYNAMIC_STATE_RASTERIZER_DISCARD_ENABLE		: ivk_CmdSetRasterizerDiscardEnable( commands, specification.RasterizerDiscard ); break;
+				case VK_DYNAMIC_STATE_DEPTH_BIAS_ENABLE				: ivk_CmdSetDepthBiasEnable( commands, specification.DepthBias ); break;
+				case VK_DYNAMIC_STATE_LINE_WIDTH					: vkCmdSetLineWidth( commands, specification.LineWidth ); break;
+				case VK_DYNAMIC_STATE_RASTERIZATION_SAMPLES_EXT		: ivk_CmdSetRasterizationSamples( commands, specification.Samples ); break;
+				case VK_DYNAMIC_STATE_SAMPLE_MASK_EXT				: ivk_CmdSetSampleMask( commands, specification.Samples, sample_mask.data( ) ); break;
+				case VK_DYNAMIC_STATE_ALPHA_TO_COVERAGE_ENABLE_EXT	: ivk_CmdSetAlphaToCoverageEnable( commands, specification.AlphaToCoverage ); break;
+				case VK_DYNAMIC_STATE_STENCIL_TEST_ENABLE			: ivk_CmdSetStencilTestEnable( commands, specification.StencilTest ); break;
+
+				case VK_DYNAMIC_STATE_VERTEX_INPUT_EXT :
+					ivk_CmdSetVertexInput( commands, binding_count, specification.VertexBindings.data( ), attribute_count, specification.VertexAttributes.data( ) );
+					break;
+
+				case VK_DYNAMIC_STATE_COLOR_BLEND_ENABLE_EXT :
+					if ( blend_count > 0 )
+						ivk_CmdSetColorBlendEnable( commands, 0, blend_count, specification.BlendEnables.data( ) );
+					break;
+
+				case VK_DYNAMIC_STATE_COLOR_BLEND_EQUATION_EXT :
+					if ( blend_count > 0 )
+						ivk_CmdSetColorBlendEquation( commands, 0, blend_count, specification.BlendEquations.data( ) );
+					break;
+
+				case VK_DYNAMIC_STATE_COLOR_WRITE_MASK_EXT :
+					if ( blend_count > 0 )
+						ivk_CmdSetColorWriteMask( commands, 0, blend_count, specification.WriteMasks.data( ) );
+					break;
+
+				default : break;
+			}
+		}
+	}
+
+	void CmdBeginRendering(
+		const VkCommandBuffer& commands,
+		const VkRenderingInfo& rendering_info
+	) {
+		micro_assert( IsValid( commands ), "You can't execute command on an invalid command buffer" );
+		micro_assert( IsValid( ivk_CmdBeginRendering ), "Shader objects must be loaded to use this function" );
+
+		ivk_CmdBeginRendering( commands, micro_ptr( rendering_info ) );
+	}
+
+	void CmdEndRendering( const VkCommandBuffer& commands ) {
+		micro_assert( IsValid( commands ), "You can't execute command on an invalid command buffer" );
+		micro_assert( IsValid( ivk_CmdEndRendering ), "Shader objects must be loaded to use this function" );
+
+		ivk_CmdEndRendering( commands );
+	}
+
+	void CmdBindShaderObjects(
+		const VkCommandBuffer& commands,
+		const std::vector<VkShaderStageFlagBits>& stages,
+		const std::vector<VkShaderEXT>& shaders
+	) {
+		micro_assert( IsValid( commands ), "You can't execute command on an invalid command buffer" );
+		micro_assert( stages.size( ) == shaders.size( ), "Every shader object stage must match a shader object" );
+
+		const auto stage_count = (uint32_t)stages.size( );
+
+		if ( stage_count > 0 )
+			ivk_CmdBindShaders( commands, stage_count, stages.data( ), shaders.data( ) );
 	}
 
 	void CmdBindDescriptorSets(
@@ -864,6 +1104,63 @@ namespace vk {
 		vkCmdBindVertexBuffers( commands, start_id, buffer_count, buffer_data, offset_data );
 	}
 
+	void CmdDispatch(
+		const VkCommandBuffer& commands,
+		const VkExtent3D& group_count
+	) {
+		micro_assert( IsValid( commands ), "You can't execute command on an invalid command buffer" );
+
+		if ( group_count.width > 0 && group_count.height > 0 && group_count.depth > 0 )
+			vkCmdDispatch( commands, group_count.width, group_count.height, group_count.depth );
+	}
+
+	void CmdDispatchIndirect(
+		const VkCommandBuffer& commands,
+		const VkBuffer& buffer,
+		const VkDeviceSize offset
+	) {
+		micro_assert( IsValid( commands ), "You can't execute command on an invalid command buffer" );
+		micro_assert( IsValid( buffer ), "You can't dispatch from an invalid indirect buffer" );
+
+		vkCmdDispatchIndirect( commands, buffer, offset );
+	}
+
+	void CmdCopyBufferToImage(
+		const VkCommandBuffer& commands,
+		const VkBuffer& buffer,
+		const VkImage& image,
+		const VkImageLayout layout,
+		const std::vector<VkBufferImageCopy>& regions
+	) {
+		micro_assert( IsValid( commands ), "You can't execute command on an invalid command buffer" );
+
+		const auto region_count = (uint32_t)regions.size( );
+
+		if ( !IsValid( buffer ) || !IsValid( image ) || region_count == 0 )
+			return;
+
+		const auto* region_data = regions.data( );
+
+		vkCmdCopyBufferToImage( commands, buffer, image, layout, region_count, region_data );
+	}
+
+	void CmdBlitImage(
+		const VkCommandBuffer& commands,
+		const VkImage& source,
+		const VkImageLayout source_layout,
+		const VkImage& destination,
+		const VkImageLayout destination_layout,
+		const VkImageBlit& region,
+		const VkFilter filter
+	) {
+		micro_assert( IsValid( commands ), "You can't execute command on an invalid command buffer" );
+
+		if ( !IsValid( source ) || !IsValid( destination ) )
+			return;
+
+		vkCmdBlitImage( commands, source, source_layout, destination, destination_layout, 1, micro_ptr( region ), filter );
+	}
+
 	VkResult AcquireNextImage(
 		const VkDevice device,
 		const VkSwapchainKHR swapchain,
@@ -1197,6 +1494,165 @@ namespace vk {
 		return result;
 	}
 
+	bool GetShaderModuleIdentifier(
+		const VkDevice& device,
+		const VkShaderModuleCreateInfo& specification,
+		std::vector<uint8_t>& identifier
+	) {
+		micro_assert( IsValid( device ), "Vulkan Device must be valid to use this function" );
+
+		if ( !IsValid( ivk_GetShaderModuleIdentifier ) )
+			ivk_GetShaderModuleIdentifier = vk::GetDeviceProcAddr<PFN_vkGetShaderModuleCreateInfoIdentifierEXT>( device, "vkGetShaderModuleCreateInfoIdentifierEXT" );
+
+		if ( !IsValid( ivk_GetShaderModuleIdentifier ) )
+			return false;
+
+		auto module_identifier = VkShaderModuleIdentifierEXT{ };
+
+		module_identifier.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_IDENTIFIER_EXT;
+		module_identifier.pNext = VK_NULL_HANDLE;
+
+		ivk_GetShaderModuleIdentifier( device, micro_ptr( specification ), micro_ptr( module_identifier ) );
+
+		identifier.assign( module_identifier.identifier, module_identifier.identifier + module_identifier.identifierSize );
+
+		return !identifier.empty( );
+	}
+
+	VkExtent3D GetDispatchSize( const VkExtent3D& size, const VkExtent3D& local_size ) {
+		auto group_count = VkExtent3D{ };
+
+		group_count.width  = ( size.width + std::max( local_size.width, 1u ) - 1 ) / std::max( local_size.width, 1u );
+		group_count.height = ( size.height + std::max( local_size.height, 1u ) - 1 ) / std::max( local_size.height, 1u );
+		group_count.depth  = ( size.depth + std::max( local_size.depth, 1u ) - 1 ) / std::max( local_size.depth, 1u );
+
+		return group_count;
+	}
+
+	FormatBlock GetFormatBlock( const VkFormat format ) {
+		constexpr uint32_t astc_blocks[ 14 ][ 2 ] = {
+			{  4,  4 }, {  5,  4 }, {  5,  5 }, {  6,  5 }, {  6,  6 }, {  8,  5 }, {  8,  6 },
+			{  8,  8 }, { 10,  5 }, { 10,  6 }, { 10,  8 }, { 10, 10 }, { 12, 10 }, { 12, 12 }
+		};
+
+		auto block = FormatBlock{ };
+
+		if ( format == VK_FORMAT_UNDEFINED )
+			block.Size = 0;
+		else if ( format == VK_FORMAT_R4G4_UNORM_PACK8 || ( format >= VK_FORMAT_R8_UNORM && format <= VK_FORMAT_R8_SRGB ) )
+			block.Size = 1;
+		else if ( format <= VK_FORMAT_A1R5G5B5_UNORM_PACK16 || ( format >= VK_FORMAT_R8G8_UNORM && format <= VK_FORMAT_R8G8_SRGB ) )
+			block.Size = 2;
+		else if ( format >= VK_FORMAT_R8G8B8_UNORM && format <= VK_FORMAT_B8G8R8_SRGB )
+			block.Size = 3;
+		else if ( format >= VK_FORMAT_R8G8B8A8_UNORM && format <= VK_FORMAT_A2B10G10R10_SINT_PACK32 )
+			block.Size = 4;
+		else if ( format >= VK_FORMAT_R16_UNORM && format <= VK_FORMAT_R16_SFLOAT )
+			block.Size = 2;
+		else if ( format >= VK_FORMAT_R16G16_UNORM && format <= VK_FORMAT_R16G16_SFLOAT )
+			block.Size = 4;
+		else if ( format >= VK_FORMAT_R16G16B16_UNORM && format <= VK_FORMAT_R16G16B16_SFLOAT )
+			block.Size = 6;
+		else if ( format >= VK_FORMAT_R16G16B16A16_UNORM && format <= VK_FORMAT_R16G16B16A16_SFLOAT )
+			block.Size = 8;
+		else if ( format >= VK_FORMAT_R32_UINT && format <= VK_FORMAT_R32G32B32A32_SFLOAT )
+			block.Size = 4 * ( 1 + ( format - VK_FORMAT_R32_UINT ) / 3 );
+		else if ( format >= VK_FORMAT_R64_UINT && format <= VK_FORMAT_R64G64B64A64_SFLOAT )
+			block.Size = 8 * ( 1 + ( format - VK_FORMAT_R64_UINT ) / 3 );
+		else if ( format == VK_FORMAT_B10G11R11_UFLOAT_PACK32 || format == VK_FORMAT_E5B9G9R9_UFLOAT_PACK32 )
+			block.Size = 4;
+		else if ( format == VK_FORMAT_D16_UNORM )
+			block.Size = 2;
+		else if ( format == VK_FORMAT_X8_D24_UNORM_PACK32 || format == VK_FORMAT_D32_SFLOAT )
+			block.Size = 4;
+		else if ( format == VK_FORMAT_S8_UINT )
+			block.Size = 1;
+		else if ( format == VK_FORMAT_D16_UNORM_S8_UINT )
+			block.Size = 3;
+		else if ( format == VK_FORMAT_D24_UNORM_S8_UINT )
+			block.Size = 4;
+		else if ( format == VK_FORMAT_D32_SFLOAT_S8_UINT )
+			block.Size = 8;
+		else if ( format >= VK_FORMAT_BC1_RGB_UNORM_BLOCK && format <= VK_FORMAT_EAC_R11G11_SNORM_BLOCK ) {
+			block.Width  = 4;
+			block.Height = 4;
+
+			if (
+				format <= VK_FORMAT_BC1_RGBA_SRGB_BLOCK ||
+				format == VK_FORMAT_BC4_UNORM_BLOCK		||
+				format == VK_FORMAT_BC4_SNORM_BLOCK		||
+				( format >= VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK && format <= VK_FORMAT_ETC2_R8G8B8A1_SRGB_BLOCK ) ||
+				format == VK_FORMAT_EAC_R11_UNORM_BLOCK ||
+				format == VK_FORMAT_EAC_R11_SNORM_BLOCK
+			)
+				block.Size = 8;
+			else
+				block.Size = 16;
+		} else if ( format >= VK_FORMAT_ASTC_4x4_UNORM_BLOCK && format <= VK_FORMAT_ASTC_12x12_SRGB_BLOCK ) {
+			const auto astc_id = ( format - VK_FORMAT_ASTC_4x4_UNORM_BLOCK ) / 2;
+
+			block.Width  = astc_blocks[ astc_id ][ 0 ];
+			block.Height = astc_blocks[ astc_id ][ 1 ];
+			block.Size   = 16;
+		}
+
+		return block;
+	}
+
+	VkPipelineStageFlags GetLayoutStage( const VkImageLayout layout ) {
+		auto stage = (VkPipelineStageFlags)VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+
+		switch ( layout ) {
+			case VK_IMAGE_LAYOUT_UNDEFINED		  :
+			case VK_IMAGE_LAYOUT_PREINITIALIZED : stage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT; break;
+			
+			case VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL :
+			case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL : stage = VK_PIPELINE_STAGE_TRANSFER_BIT; break;
+
+			case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL : stage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT; break;
+			case VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL : stage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT; break;
+
+			case VK_IMAGE_LAYOUT_DEPTH_ATTACHMENT_OPTIMAL		  :
+			case VK_IMAGE_LAYOUT_STENCIL_ATTACHMENT_OPTIMAL		  :
+			case VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL : 
+				stage = VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+				break;
+
+			case VK_IMAGE_LAYOUT_PRESENT_SRC_KHR : stage = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT; break;
+
+			default : break;
+		}
+
+		return stage;
+	}
+
+	VkAccessFlags GetLayoutAccess( const VkImageLayout layout ) {
+		auto access = (VkAccessFlags)VK_ACCESS_NONE;
+
+		switch ( layout ) {
+			case VK_IMAGE_LAYOUT_PREINITIALIZED			  : access = VK_ACCESS_HOST_WRITE_BIT; break;
+			case VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL	  : access = VK_ACCESS_TRANSFER_READ_BIT; break;
+			case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL	  : access = VK_ACCESS_TRANSFER_WRITE_BIT; break;
+			case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL : access = VK_ACCESS_SHADER_READ_BIT; break;
+			
+			case VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL : 
+				access = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT; 
+				break;
+
+			case VK_IMAGE_LAYOUT_DEPTH_ATTACHMENT_OPTIMAL		  :
+			case VK_IMAGE_LAYOUT_STENCIL_ATTACHMENT_OPTIMAL		  :
+			case VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL :
+				access = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+				break;
+
+			case VK_IMAGE_LAYOUT_GENERAL : access = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT; break;
+
+			default : break;
+		}
+
+		return access;
+	}
+
 	micro_string ToString(
 		const VkDebugUtilsMessageSeverityFlagBitsEXT debug_severity
 	) {
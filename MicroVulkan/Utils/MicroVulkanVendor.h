@@ -124,6 +124,47 @@ namespace vk {
 
 	};
 
+	/**
+	 * FormatBlock struct
+	 * @note : Defined texel block dimensions and byte size of a Vulkan format.
+	 **/
+	micro_struct FormatBlock {
+
+		uint32_t Width  = 1;
+		uint32_t Height = 1;
+		uint32_t Size	= 0;
+
+	};
+
+	/**
+	 * DynamicStateSpecification struct
+	 * @note : Values applied by CmdSetDynamicState, blend arrays hold one
+	 *		   entry per color attachment.
+	 **/
+	micro_struct DynamicStateSpecification {
+
+		VkPrimitiveTopology Topology	= VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+		VkBool32 PrimitiveRestart		= VK_FALSE;
+		VkBool32 RasterizerDiscard		= VK_FALSE;
+		VkCullModeFlags CullMode		= VK_CULL_MODE_NONE;
+		VkFrontFace FrontFace			= VK_FRONT_FACE_COUNTER_CLOCKWISE;
+		VkPolygonMode PolygonMode		= VK_POLYGON_MODE_FILL;
+		VkBool32 DepthBias				= VK_FALSE;
+		float LineWidth					= 1.f;
+		VkSampleCountFlagBits Samples	= VK_SAMPLE_COUNT_1_BIT;
+		VkBool32 AlphaToCoverage		= VK_FALSE;
+		VkBool32 DepthTest				= VK_FALSE;
+		VkBool32 DepthWrite				= VK_FALSE;
+		VkCompareOp DepthCompare		= VK_COMPARE_OP_LESS;
+		VkBool32 StencilTest			= VK_FALSE;
+		std::vector<VkVertexInputBindingDescription2EXT> VertexBindings{ };
+		std::vector<VkVertexInputAttributeDescription2EXT> VertexAttributes{ };
+		std::vector<VkBool32> BlendEnables{ };
+		std::vector<VkColorBlendEquationEXT> BlendEquations{ };
+		std::vector<VkColorComponentFlags> WriteMasks{ };
+
+	};
+
 	/**
 	 * SetAllocationCallback method
 	 * @note : Set current allocator callback structure.
@@ -289,6 +330,14 @@ namespace vk {
 
 	MICRO_API void DestroyPipelineLayout( const VkDevice& device, VkPipelineLayout& layout );
 
+	MICRO_API VkResult CreateDescriptorSetLayout(
+		const VkDevice& device,
+		const VkDescriptorSetLayoutCreateInfo& specification,
+		VkDescriptorSetLayout& layout
+	);
+
+	MICRO_API void DestroyDescriptorSetLayout( const VkDevice& device, VkDescriptorSetLayout& layout );
+
 	MICRO_API VkResult CreateDescriptorPool(
 		const VkDevice& device,
 		const VkDescriptorPoolCreateInfo& specification,
@@ -318,6 +367,11 @@ namespace vk {
 		std::vector<VkDescriptorSet>& descriptor_list 
 	);
 
+	MICRO_API VkResult ResetDescriptorPool(
+		const VkDevice& device,
+		const VkDescriptorPool& descriptor_pool
+	);
+
 	MICRO_API VkResult CreateShader(
 		const VkDevice& device,
 		const VkShaderModuleCreateInfo& specification,
@@ -350,6 +404,14 @@ namespace vk {
 
 	MICRO_API void DestroyQueryPool( const VkDevice& device, VkQueryPool& query_pool );
 
+	MICRO_API VkResult CreateShaderObject(
+		const VkDevice& device,
+		const VkShaderCreateInfoEXT& specification,
+		VkShaderEXT& shader
+	);
+
+	MICRO_API void DestroyShaderObject( const VkDevice& device, VkShaderEXT& shader );
+
 	MICRO_API VkResult WaitForFence(
 		const VkDevice& device,
 		const VkFence& fence,
@@ -407,6 +469,65 @@ namespace vk {
 		const std::vector<VkScissor>& scissors
 	);
 
+	MICRO_API void CmdBindPipeline(
+		const VkCommandBuffer& commands,
+		const VkPipelineBindPoint bind_point,
+		const VkPipeline& pipeline
+	);
+
+	MICRO_API void CmdPushConstants(
+		const VkCommandBuffer& commands,
+		const VkPipelineLayout& layout,
+		const VkShaderStageFlags stages,
+		const uint32_t offset,
+		const uint32_t length,
+		const void* data
+	);
+
+	/**
+	 * LoadDynamicState function
+	 * @note : Load extended dynamic state 1 & 3 entry points, must be called
+	 *		   once the device is created with the matching extensions.
+	 * @param device : Query Vulkan device.
+	 **/
+	MICRO_API void LoadDynamicState( const VkDevice& device );
+
+	/**
+	 * LoadShaderObject function
+	 * @note : Load shader object entry points, once loaded viewports and
+	 *		   scissors are also recorded with their count as shader objects
+	 *		   have no static state.
+	 * @param device : Query Vulkan device.
+	 **/
+	MICRO_API void LoadShaderObject( const VkDevice& device );
+
+	/**
+	 * CmdSetDynamicState function
+	 * @note : Record the listed extended dynamic states, viewport and scissor
+	 *		   are skipped as they depend on the render target.
+	 * @param commands : Query command buffer.
+	 * @param dynamic_states : Query dynamic states of the bound pipeline.
+	 * @param specification : Query dynamic state values.
+	 **/
+	MICRO_API void CmdSetDynamicState(
+		const VkCommandBuffer& commands,
+		const std::vector<VkDynamicState>& dynamic_states,
+		const DynamicStateSpecification& specification
+	);
+
+	MICRO_API void CmdBeginRendering(
+		const VkCommandBuffer& commands,
+		const VkRenderingInfo& rendering_info
+	);
+
+	MICRO_API void CmdEndRendering( const VkCommandBuffer& commands );
+
+	MICRO_API void CmdBindShaderObjects(
+		const VkCommandBuffer& commands,
+		const std::vector<VkShaderStageFlagBits>& stages,
+		const std::vector<VkShaderEXT>& shaders
+	);
+
 	MICRO_API void CmdBindDescriptorSets(
 		const VkCommandBuffer& commands,
 		const VkPipelineBindPoint bind_point,
@@ -430,6 +551,35 @@ namespace vk {
 		const std::vector<BufferBindSpecification>& buffer_binds
 	);
 
+	MICRO_API void CmdDispatch(
+		const VkCommandBuffer& commands,
+		const VkExtent3D& group_count
+	);
+
+	MICRO_API void CmdDispatchIndirect(
+		const VkCommandBuffer& commands,
+		const VkBuffer& buffer,
+		const VkDeviceSize offset
+	);
+
+	MICRO_API void CmdCopyBufferToImage(
+		const VkCommandBuffer& commands,
+		const VkBuffer& buffer,
+		const VkImage& image,
+		const VkImageLayout layout,
+		const std::vector<VkBufferImageCopy>& regions
+	);
+
+	MICRO_API void CmdBlitImage(
+		const VkCommandBuffer& commands,
+		const VkImage& source,
+		const VkImageLayout source_layout,
+		const VkImage& destination,
+		const VkImageLayout destination_layout,
+		const VkImageBlit& region,
+		const VkFilter filter
+	);
+
 	MICRO_API VkResult AcquireNextImage(
 		const VkDevice device,
 		const VkSwapchainKHR swapchain,
@@ -546,6 +696,56 @@ namespace vk {
 		std::vector<uint8_t>& cache_data
 	);
 
+	/**
+	 * GetShaderModuleIdentifier function
+	 * @note : Wrapper for VK_EXT_shader_module_identifier, compute the driver
+	 *		   identifier of a module without creating it.
+	 * @param device : Reference to current Vulkan device instance.
+	 * @param specification : Reference to shader module specification.
+	 * @param identifier : Reference to identifier byte vector.
+	 * @return : True when the identifier is available.
+	 **/
+	MICRO_API bool GetShaderModuleIdentifier(
+		const VkDevice& device,
+		const VkShaderModuleCreateInfo& specification,
+		std::vector<uint8_t>& identifier
+	);
+
+	/**
+	 * GetDispatchSize function
+	 * @note : Get the workgroup count covering a problem size, each axis is
+	 *		   rounded up so the last group may run partially out of bounds.
+	 * @param size : Query problem size in invocations.
+	 * @param local_size : Query workgroup size of the compute shader.
+	 * @return : Workgroup count per axis.
+	 **/
+	MICRO_API VkExtent3D GetDispatchSize( const VkExtent3D& size, const VkExtent3D& local_size );
+
+	/**
+	 * GetFormatBlock function
+	 * @note : Get texel block dimensions and byte size of a format, used to
+	 *		   compute linear upload sizes for plain and block-compressed formats.
+	 * @param format : Query format.
+	 * @return : Block description, Size is 0 for unsupported formats.
+	 **/
+	MICRO_API FormatBlock GetFormatBlock( const VkFormat format );
+
+	/**
+	 * GetLayoutStage function
+	 * @note : Get pipeline stages that access an image in the query layout.
+	 * @param layout : Query image layout.
+	 * @return : Pipeline stage mask for barrier.
+	 **/
+	MICRO_API VkPipelineStageFlags GetLayoutStage( const VkImageLayout layout );
+
+	/**
+	 * GetLayoutAccess function
+	 * @note : Get memory accesses performed on an image in the query layout.
+	 * @param layout : Query image layout.
+	 * @return : Access mask for barrier.
+	 **/
+	MICRO_API VkAccessFlags GetLayoutAccess( const VkImageLayout layout );
+
 	MICRO_API micro_string ToString(
 		const VkDebugUtilsMessageSeverityFlagBitsEXT debug_severity
 	);
@@ -571,4 +771,13 @@ namespace vk {
 		return micro_cast( vkGetInstanceProcAddr( instance, procedure ), VkFunction );
 	};
 
+	template<typename VkFunction>
+		requires IsVkObject<VkFunction>
+	VkFunction GetDeviceProcAddr( 
+		const VkDevice& device, 
+		micro_string procedure 
+	) {
+		return micro_cast( vkGetDeviceProcAddr( device, procedure ), VkFunction );
+	};
+
 };
@@ -0,0 +1,168 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "__micro_vulkan_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+MicroVulkanWorkerPool::MicroVulkanWorkerPool( )
+	: m_threads{ },
+	m_tasks{ },
+	m_mutex{ },
+	m_condition{ },
+	m_is_running{ false }
+{ }
+
+MicroVulkanWorkerPool::~MicroVulkanWorkerPool( ) {
+	Destroy( );
+}
+
+bool MicroVulkanWorkerPool::Create( ) {
+	auto thread_count = std::thread::hardware_concurrency( );
+
+	// Keep one core for the calling thread, it takes part in ParallelFor.
+	return Create( thread_count > 1 ? thread_count - 1 : 1 );
+}
+
+bool MicroVulkanWorkerPool::Create( const uint32_t thread_count ) {
+	Destroy( );
+
+	m_is_running = true;
+
+	while ( m_threads.size( ) < thread_count )
+		m_threads.emplace_back( [ this ]( ) { Run( ); } );
+
+	return GetThreadCount( ) > 0;
+}
+
+void MicroVulkanWorkerPool::ParallelFor(
+	const uint32_t count,
+	const std::function<void( const uint32_t )>& task
+) {
+	auto next	 = std::make_shared<std::atomic<uint32_t>>( 0 );
+	auto worker  = [ next, count, &task ]( ) {
+		auto index = next->fetch_add( 1 );
+
+		while ( index < count ) {
+			task( index );
+
+			index = next->fetch_add( 1 );
+		}
+	};
+	auto helpers = std::min( GetThreadCount( ), count > 0 ? count - 1 : 0 );
+	auto futures = std::vector<std::future<void>>{ };
+
+	futures.reserve( helpers );
+
+	while ( helpers-- > 0 )
+		futures.emplace_back( Dispatch( worker ) );
+
+	worker( );
+
+	// Waiting threads run queued tasks, a nested call from a worker would
+	// otherwise wait on helpers no free thread is left to run.
+	for ( auto& future : futures ) {
+		while ( future.wait_for( std::chrono::seconds{ 0 } ) != std::future_status::ready ) {
+			if ( !RunPending( ) )
+				future.wait( );
+		}
+	}
+}
+
+void MicroVulkanWorkerPool::Destroy( ) {
+	{
+		auto lock = std::unique_lock{ m_mutex };
+
+		m_is_running = false;
+	}
+
+	m_condition.notify_all( );
+
+	for ( auto& thread : m_threads ) {
+		if ( thread.joinable( ) )
+			thread.join( );
+	}
+
+	m_threads.clear( );
+	m_tasks.clear( );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+void MicroVulkanWorkerPool::Run( ) {
+	while ( true ) {
+		auto task = std::function<void( )>{ };
+
+		{
+			auto lock = std::unique_lock{ m_mutex };
+
+			m_condition.wait( lock, [ this ]( ) { return !m_is_running || !m_tasks.empty( ); } );
+
+			// Pending tasks are drained before exit so no future is left broken.
+			if ( m_tasks.empty( ) )
+				return;
+
+			task = std::move( m_tasks.front( ) );
+
+			m_tasks.pop_front( );
+		}
+
+		task( );
+	}
+}
+
+bool MicroVulkanWorkerPool::RunPending( ) {
+	auto task = std::function<void( )>{ };
+
+	{
+		auto lock = std::unique_lock{ m_mutex };
+
+		if ( m_tasks.empty( ) )
+			return false;
+
+		task = std::move( m_tasks.front( ) );
+
+		m_tasks.pop_front( );
+	}
+
+	task( );
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t MicroVulkanWorkerPool::GetThreadCount( ) const {
+	return (uint32_t)m_threads.size( );
+}
@@ -0,0 +1,92 @@
+/**
+ *
+ *  __  __ _          __   __    _ _
+ * |  \/  (_)__ _ _ __\ \ / /  _| | |____ _ _ _
+ * | |\/| | / _| '_/ _ \ V / || | | / / _` | ' \
+ * |_|  |_|_\__|_| \___/\_/ \_,_|_|_\_\__,_|_||_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024- Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once 
+
+#include "MicroVulkanMappedFile.h"
+
+micro_class MicroVulkanWorkerPool final {
+
+private:
+	std::vector<std::thread> m_threads;
+	std::deque<std::function<void( )>> m_tasks;
+	std::mutex m_mutex;
+	std::condition_variable m_condition;
+	bool m_is_running;
+
+public:
+	MicroVulkanWorkerPool( );
+
+	MicroVulkanWorkerPool( const MicroVulkanWorkerPool& ) = delete;
+
+	~MicroVulkanWorkerPool( );
+
+	bool Create( );
+
+	bool Create( const uint32_t thread_count );
+
+	template<typename Task>
+	auto Dispatch( Task&& task ) -> std::future<std::invoke_result_t<Task>> {
+		using Result = std::invoke_result_t<Task>;
+
+		auto packaged = std::make_shared<std::packaged_task<Result( )>>( std::forward<Task>( task ) );
+		auto future	  = packaged->get_future( );
+
+		if ( GetThreadCount( ) > 0 ) {
+			{
+				auto lock = std::unique_lock{ m_mutex };
+
+				m_tasks.emplace_back( [ packaged ]( ) { ( *packaged )( ); } );
+			}
+
+			m_condition.notify_one( );
+		} else
+			( *packaged )( );
+
+		return future;
+	}
+
+	void ParallelFor( 
+		const uint32_t count, 
+		const std::function<void( const uint32_t )>& task 
+	);
+
+	void Destroy( );
+
+private:
+	void Run( );
+
+	bool RunPending( );
+
+public:
+	uint32_t GetThreadCount( ) const;
+
+};
@@ -31,5 +31,5 @@
 
 #pragma once 
 
-#include "Compiler/MicroVulkanCompiler.h"
-#include "Ressources/Materials/MicroMaterial.h"
+#include "Compiler/MicroVulkanCompilerPermutations.h"
+#include "Ressources/Materials/MicroMaterialReloader.h"